@@ -0,0 +1,246 @@
+#include "Arena.h"
+#include <cstdlib>
+#include <new>
+#ifdef WIN32
+  #include <malloc.h>
+#endif
+
+using namespace Symbolics;
+
+// Bloecke sind auf ihre Groesse ausgerichtet, so findet delete ueber die Adresse
+// des Objekts den Blockkopf und damit die Arena
+static const size_t BLOCKSIZE = 64*1024;
+// Ausrichtung und Groessenklassen
+static const size_t ALIGN = 16;
+// groessere Objekte bekommen einen eigenen Block
+static const size_t MAXSMALL = 1024;
+static const size_t HEADERSIZE = ((sizeof(void*)*2 + ALIGN - 1) / ALIGN) * ALIGN;
+
+/*****************************************************************************/
+static inline size_t roundUp( size_t size )
+/*****************************************************************************/
+{
+    return ((size + ALIGN - 1) / ALIGN) * ALIGN;
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+static void* alignedAlloc( size_t size )
+/*****************************************************************************/
+{
+#ifdef WIN32
+    void *p = _aligned_malloc(size, BLOCKSIZE);
+#else
+    void *p = NULL;
+    if (posix_memalign(&p, BLOCKSIZE, size) != 0)
+        p = NULL;
+#endif
+    if (p == NULL)
+        throw std::bad_alloc();
+    return p;
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+static void alignedFree( void *p )
+/*****************************************************************************/
+{
+#ifdef WIN32
+    _aligned_free(p);
+#else
+    ::free(p);
+#endif
+}
+/*****************************************************************************/
+
+
+/*****************************************************************************/
+Arena::Arena():
+m_blocks(NULL), m_pos(NULL), m_end(NULL), m_free(MAXSMALL/ALIGN + 1, static_cast<void*>(NULL)),
+m_reserved(0), m_used(0), m_objects(0), m_refCount(0)
+/*****************************************************************************/
+{
+}
+/*****************************************************************************/
+
+
+/*****************************************************************************/
+Arena::~Arena()
+/*****************************************************************************/
+{
+    // alle Bloecke auf einmal freigeben
+    while (m_blocks != NULL)
+    {
+        Block *next = m_blocks->next;
+        alignedFree(m_blocks);
+        m_blocks = next;
+    }
+}
+/*****************************************************************************/
+
+
+/*****************************************************************************/
+Arena*& Arena::scope()
+/*****************************************************************************/
+{
+    // lokale static, da schon statische Objekte (Int::one, ...) Speicher brauchen;
+    // der Scope haelt selbst eine Referenz
+    static Arena* current = NULL;
+    if (current == NULL)
+    {
+        current = new Arena();
+        ++(current->m_refCount);
+    }
+    return current;
+}
+/*****************************************************************************/
+
+
+/*****************************************************************************/
+void Arena::newScope()
+/*****************************************************************************/
+{
+    Arena* old = scope();
+    scope() = new Arena();
+    ++(scope()->m_refCount);
+    if (--(old->m_refCount) == 0)
+        delete old;
+}
+/*****************************************************************************/
+
+
+/*****************************************************************************/
+ArenaPtr Arena::getScope()
+/*****************************************************************************/
+{
+    return ArenaPtr(scope());
+}
+/*****************************************************************************/
+
+
+/*****************************************************************************/
+void* Arena::allocate( size_t size )
+/*****************************************************************************/
+{
+    return scope()->alloc(size);
+}
+/*****************************************************************************/
+
+
+/*****************************************************************************/
+void Arena::deallocate( void *p, size_t size )
+/*****************************************************************************/
+{
+    if (p == NULL)
+        return;
+    // Blockkopf ueber die Ausrichtung finden
+    Block *block = reinterpret_cast<Block*>(reinterpret_cast<size_t>(p) & ~(BLOCKSIZE-1));
+    block->arena->free(p,size);
+}
+/*****************************************************************************/
+
+
+/*****************************************************************************/
+Arena::Block* Arena::newBlock( size_t size )
+/*****************************************************************************/
+{
+    Block *block = static_cast<Block*>(alignedAlloc(size));
+    block->arena = this;
+    block->next = m_blocks;
+    m_blocks = block;
+    m_reserved += size;
+    return block;
+}
+/*****************************************************************************/
+
+
+/*****************************************************************************/
+void* Arena::alloc( size_t size )
+/*****************************************************************************/
+{
+    size = roundUp(size);
+    void *p = NULL;
+    if (size > MAXSMALL)
+    {
+        // eigener Block
+        Block *block = newBlock(roundUp(HEADERSIZE + size));
+        p = reinterpret_cast<char*>(block) + HEADERSIZE;
+    }
+    else if (m_free[size/ALIGN] != NULL)
+    {
+        // aus der Freiliste
+        p = m_free[size/ALIGN];
+        m_free[size/ALIGN] = *static_cast<void**>(p);
+    }
+    else
+    {
+        if ((m_pos == NULL) || (size > static_cast<size_t>(m_end - m_pos)))
+        {
+            // neuer Block, Rest des alten bleibt ungenutzt
+            Block *block = newBlock(BLOCKSIZE);
+            m_pos = reinterpret_cast<char*>(block) + HEADERSIZE;
+            m_end = reinterpret_cast<char*>(block) + BLOCKSIZE;
+        }
+        p = m_pos;
+        m_pos += size;
+    }
+    m_used += size;
+    ++m_objects;
+    // jedes Objekt haelt die Arena am Leben
+    ++m_refCount;
+    return p;
+}
+/*****************************************************************************/
+
+
+/*****************************************************************************/
+void Arena::free( void *p, size_t size )
+/*****************************************************************************/
+{
+    size = roundUp(size);
+    if (size > MAXSMALL)
+    {
+        // eigenen Block gleich wieder freigeben
+        Block *block = reinterpret_cast<Block*>(static_cast<char*>(p) - HEADERSIZE);
+        Block **b = &m_blocks;
+        while ((*b != NULL) && (*b != block))
+            b = &((*b)->next);
+        if (*b != NULL)
+        {
+            *b = block->next;
+            m_reserved -= roundUp(HEADERSIZE + size);
+            alignedFree(block);
+        }
+    }
+    else
+    {
+        *static_cast<void**>(p) = m_free[size/ALIGN];
+        m_free[size/ALIGN] = p;
+    }
+    m_used -= size;
+    --m_objects;
+    if (--m_refCount == 0)
+        delete this;
+}
+/*****************************************************************************/
+
+
+/*****************************************************************************/
+namespace Symbolics
+{
+    // increment reference count of object *p
+    void intrusive_ptr_add_ref( const Symbolics::Arena* p)
+    {
+        Symbolics::Arena* a = const_cast<Symbolics::Arena*>(p);
+        ++(a->m_refCount);
+    }
+
+    // decrement reference count, and delete object when reference count reaches 0
+    void intrusive_ptr_release( const Symbolics::Arena* p)
+    {
+        Symbolics::Arena* a = const_cast<Symbolics::Arena*>(p);
+        if (--(a->m_refCount) == 0)
+            delete p;
+    }
+};
+/*****************************************************************************/
@@ -1,24 +1,39 @@
 #include "Basic.h"
 #include "Factory.h"
+#include <functional>
+#include <algorithm>
+#include <iterator>
 
 using namespace Symbolics;
 
+/*****************************************************************************/
+size_t Basic::m_epoch = 1;
+/*****************************************************************************/
+
 /*****************************************************************************/
 Basic::Basic( Basic_Type const& type):
-m_type(type), m_refCount(0),m_simplified(false)
+m_type(type), m_simplifiedEpoch(0),m_changedEpoch(0),m_hash(0),m_hashValid(false),m_firstParent(NULL),m_parentsSize(0),m_refCount(0),m_internKey(0)
 /*****************************************************************************/
 {
-    calcHash();
 }
 /*****************************************************************************/
 
 
 /*****************************************************************************/
 Basic::Basic( Basic_Type const& type,  Shape const& shape):
-m_type(type), m_shape(shape), m_refCount(0),m_simplified(false)
+m_type(type), m_shape(shape), m_simplifiedEpoch(0),m_changedEpoch(0),m_hash(0),m_hashValid(false),m_firstParent(NULL),m_parentsSize(0),m_refCount(0),m_internKey(0)
+/*****************************************************************************/
+{
+}
+/*****************************************************************************/
+
+
+/*****************************************************************************/
+Basic::Basic( Basic const& src ):
+m_type(src.m_type), m_shape(src.m_shape), m_simplifiedEpoch(src.m_simplifiedEpoch), m_changedEpoch(src.m_changedEpoch), m_hash(0), m_hashValid(false), m_firstParent(NULL), m_parentsSize(0),
+m_refCount(0), m_internKey(0)
 /*****************************************************************************/
 {
-    calcHash();
 }
 /*****************************************************************************/
 
@@ -27,6 +42,9 @@ m_type(type), m_shape(shape), m_refCount(0),m_simplified(false)
 Basic::~Basic()
 /*****************************************************************************/
 {
+    // aus der Hash-Consing Tabelle austragen
+    if (m_internScope.get() != NULL)
+        m_internScope->remove(m_internKey,this);
 }
 /*****************************************************************************/
 
@@ -44,12 +62,96 @@ bool Basic::operator !=( Symbolics::Basic const& rhs) const
 Basic::BasicSet Basic::getAtoms() 
 /*****************************************************************************/
 {
+    AtomListPtr const& list = getAtomList();
     BasicSet atoms;
-    getAtoms(atoms);
+    for (AtomList::SymbolVec::const_iterator ii = list->symbols.begin(); ii != list->symbols.end(); ++ii)
+        atoms.insert(BasicPtr(const_cast<Basic*>(*ii)));
     return atoms;
 }
 /*****************************************************************************/
 
+/*****************************************************************************/
+// berechnet die Atome von unten nach oben, Knoten mit gueltigen Atomen
+// werden nicht noch einmal besucht
+class Basic::AtomWalker: public Basic::Walker
+{
+public:
+    AtomWalker(): m_empty(emptyAtoms()) {;}
+    bool enter(Basic const* p, bool &)
+    {
+        return p->m_atoms.get() == NULL;
+    }
+    void leave(Basic const* p, bool &)
+    {
+        if (p->getType() == Type_Symbol)
+        {
+            AtomListPtr list(new AtomList());
+            list->symbols.push_back(p);
+            // gleiche Namen, gleicher Hash, gleiches Bit
+            list->mask = static_cast<size_t>(1) << (hashMix(p->getHash()) % (sizeof(size_t)*8));
+            p->m_atoms = list;
+            return;
+        }
+        // Liste eines Arguments teilen, wenn die anderen nichts beitragen
+        AtomListPtr result = m_empty;
+        for (size_t i=0; i<p->getArgsSize(); ++i)
+        {
+            AtomListPtr const& arg = p->getArg(i)->m_atoms;
+            if ((arg.get() == result.get()) || arg->empty())
+                continue;
+            if (result->empty())
+            {
+                result = arg;
+                continue;
+            }
+            AtomListPtr merged(new AtomList());
+            merged->symbols.reserve(result->size() + arg->size());
+            std::set_union(result->symbols.begin(), result->symbols.end(),
+                           arg->symbols.begin(), arg->symbols.end(),
+                           std::back_inserter(merged->symbols));
+            merged->mask = result->mask | arg->mask;
+            if (merged->size() == result->size())
+                continue;
+            if (merged->size() == arg->size())
+                result = arg;
+            else
+                result = merged;
+        }
+        p->m_atoms = result;
+    }
+private:
+    AtomListPtr m_empty;
+
+    // eine gemeinsame leere Liste fuer alle Konstanten
+    static AtomListPtr const& emptyAtoms()
+    {
+        static AtomListPtr empty(new AtomList());
+        return empty;
+    }
+};
+/*****************************************************************************/
+
+/*****************************************************************************/
+AtomListPtr const& Basic::getAtomList() const
+/*****************************************************************************/
+{
+    if (m_atoms.get() == NULL)
+    {
+        AtomWalker walker;
+        walkExp(walker);
+    }
+    return m_atoms;
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+bool AtomList::contains( Basic const* symbol ) const
+/*****************************************************************************/
+{
+    return std::binary_search(symbols.begin(), symbols.end(), symbol);
+}
+/*****************************************************************************/
+
 
 /*****************************************************************************/
 Basic::BasicSizeTMap Basic::getAtomsAmound() 
@@ -67,6 +169,15 @@ Basic::BasicSizeTMap Basic::getAtomsAmound()
                        BasicPtr const& new_exp)
 /*****************************************************************************/
 {
+    Memo::Pass pass(subsMemo());
+    BasicPtr done = subsMemo().find(this);
+    if (done.get() != NULL)
+        return done;
+
+    // old_exp kann hier nicht vorkommen
+    if (!mayContain(old_exp.get()))
+        return BasicPtr(this);
+
     if (*this == *old_exp.get())
         return new_exp;
 
@@ -76,7 +187,43 @@ Basic::BasicSizeTMap Basic::getAtomsAmound()
     for (size_t i=0; i<getArgsSize(); ++i)
         subs_args.push_back(getArg(i)->subs(old_exp,new_exp));
 
-    return Factory::newBasic( getType(), subs_args, getShape() );
+    return subsMemo().insert(this, Factory::newBasic( getType(), subs_args, getShape() ));
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+BasicPtr Basic::simplifyCached()
+/*****************************************************************************/
+{
+    // schon vereinfacht oder Blatt, da lohnt kein Cache
+    if (is_Simplified() || (getArgsSize() == 0) || !Factory::getInterning())
+        return simplify();
+
+    InternScope *scope = Factory::getScope().get();
+    size_t key = getHash();
+    BasicPtr done = scope->findSimplified(key, this);
+    if (done.get() != NULL)
+        return done->simplify();
+
+    // Argumente vor dem Vereinfachen merken, simplify aendert sie an Ort und Stelle
+    BasicPtrVec args;
+    args.reserve(getArgsSize());
+    for (size_t i=0; i<getArgsSize(); ++i)
+        args.push_back(getArg(i));
+    Basic_Type type = getType();
+    Shape shape = getShape();
+    BasicPtr result = simplify();
+    scope->insertSimplified(key, type, shape, args, result);
+    return result;
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+Basic::Memo& Basic::subsMemo()
+/*****************************************************************************/
+{
+    static Memo memo;
+    return memo;
 }
 /*****************************************************************************/
 
@@ -84,33 +231,135 @@ Basic::BasicSizeTMap Basic::getAtomsAmound()
  void Basic::subs( BasicPtr const& new_exp)
 /*****************************************************************************/
 {
-    // brauchen eine Kopie da setArg m_parents veraendert
-    ArgumentPtrSet parents = m_parents;
+    // brauchen eine Kopie da setArg die Parents veraendert
+    ArgumentPtrList parents = getParents();
+    std::vector<Basic*> changedParents;
+    changedParents.reserve(parents.size());
     // subs me
-    for (ArgumentPtrSet::iterator ii = parents.begin();ii!=parents.end();++ii)
+    for (ArgumentPtrList::iterator ii = parents.begin();ii!=parents.end();++ii)
     {
       (*ii)->setArg(new_exp);
-      if ((*ii)->getParent().get() != NULL)
-        (*ii)->getParent()->changed();
+      if ((*ii)->getParentPtr() != NULL)
+        changedParents.push_back((*ii)->getParentPtr());
     }
+    // nur die Parents und ihre Vorfahren muessen neu vereinfacht werden
+    changed(changedParents);
     // no parents left
     clearParents();
 }
 /*****************************************************************************/
 
 /*****************************************************************************/
- void Basic::changed()
+// Ersetzen mit einer Map, ein Memo fuer den ganzen Durchlauf
+class Basic::MapSubs
+{
+public:
+    MapSubs(BasicPtrMap const& repl): m_repl(repl), m_mask(0), m_prune(true)
+    {
+        for (BasicPtrMap::const_iterator ii = repl.begin(); ii != repl.end(); ++ii)
+        {
+            size_t m = ii->first->getAtomList()->mask;
+            // Schluessel ohne Symbole (z.B. Zahlen) koennen ueberall vorkommen
+            if (m == 0)
+                m_prune = false;
+            m_mask |= m;
+            // volle Maske schliesst nichts aus, restliche Schluessel nicht ansehen
+            // (grosse Maps, z.B. alle Symbole eines Systems)
+            if (m_mask == ~static_cast<size_t>(0))
+            {
+                m_prune = false;
+                break;
+            }
+        }
+    }
+
+    BasicPtr subs(Basic *p)
+    {
+        Memo::Pass pass(m_memo);
+        BasicPtr done = m_memo.find(p);
+        if (done.get() != NULL)
+            return done;
+
+        // kein Schluessel kann hier vorkommen
+        if (m_prune && (p->getAtomList()->mask & m_mask) == 0)
+            return BasicPtr(p);
+
+        BasicPtrMap::const_iterator ii = m_repl.find(BasicPtr(p));
+        if (ii != m_repl.end())
+            return m_memo.insert(p, ii->second);
+
+        if (p->getArgsSize() == 0)
+            return BasicPtr(p);
+
+        // subs args
+        BasicPtrVec subs_args;
+        subs_args.reserve( p->getArgsSize() );
+        for (size_t i=0; i<p->getArgsSize(); ++i)
+            subs_args.push_back(subs(p->getArg(i).get()));
+
+        return m_memo.insert(p, p->newWithArgs(subs_args));
+    }
+
+protected:
+    BasicPtrMap const& m_repl;
+    // Oder der Masken aller Schluessel
+    size_t m_mask;
+    bool m_prune;
+    Memo m_memo;
+};
+/*****************************************************************************/
+
+/*****************************************************************************/
+ BasicPtr Basic::subs( BasicPtrMap const& repl )
 /*****************************************************************************/
 {
-  //if (m_simplified)
-  {
-    m_simplified = false;
-    for (ArgumentPtrSet::iterator ii = m_parents.begin();ii!=m_parents.end();++ii)
+    if (repl.empty())
+        return BasicPtr(this);
+    MapSubs ms(repl);
+    return ms.subs(this);
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+BasicPtr Basic::newWithArgs( BasicPtrVec &args ) const
+/*****************************************************************************/
+{
+    return Factory::newBasic( getType(), args, getShape() );
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+void Basic::destroy( Basic *b )
+/*****************************************************************************/
+{
+    // Argumente, die beim Loeschen frei werden, kommen in die Liste statt
+    // rekursiv geloescht zu werden. Liste wird nie freigegeben, da auch statische
+    // Objekte (Int::one, ...) beim Beenden noch geloescht werden
+    static std::vector<Basic*> &pending = *(new std::vector<Basic*>());
+    static bool active = false;
+    pending.push_back(b);
+    if (active)
+        return;
+    active = true;
+    while (!pending.empty())
     {
-      if ((*ii)->getParent().get() != NULL)
-        (*ii)->getParent()->changed();
+        Basic *c = pending.back();
+        pending.pop_back();
+        delete c;
     }
-  }
+    active = false;
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+Basic::ArgumentPtrList Basic::getParents() const
+/*****************************************************************************/
+{
+    ArgumentPtrList parents;
+    parents.reserve(m_parentsSize);
+    for (ArgumentPtr ii = m_firstParent; ii != NULL; ii = ii->getNextParent())
+        parents.push_back(ii);
+    return parents;
 }
 /*****************************************************************************/
 
@@ -118,6 +367,11 @@ Basic::BasicSizeTMap Basic::getAtomsAmound()
  BasicPtr Basic::iterateExp(Symbolics::Basic::Iterator &v)
 /*****************************************************************************/
 {
+    Memo::Pass pass(v.memo);
+    BasicPtr done = v.memo.find(this);
+    if (done.get() != NULL)
+        return done;
+
     // iterate args
     BasicPtrVec new_args;
     new_args.reserve( getArgsSize() );
@@ -125,31 +379,170 @@ Basic::BasicSizeTMap Basic::getAtomsAmound()
         new_args.push_back(getArg(i)->iterateExp(v));
 
     BasicPtr newI = Factory::newBasic( getType(), new_args, getShape() );
-    return v.process_Arg(newI);
+    return v.memo.insert(this, v.process_Arg(newI));
 }
 /*****************************************************************************/
 
 
+/*****************************************************************************/
+namespace
+{
+    // Scanner ueber den Walker, stop beendet wie bisher nur den Abstieg
+    class ScanWalker: public Basic::Walker
+    {
+    public:
+        ScanWalker(Basic::Scanner &s): m_s(s) {;}
+        bool enter(Basic const* p, bool &)
+        {
+            bool stop = false;
+            if (!m_s.process_Arg(BasicPtr(const_cast<Basic*>(p)),stop))
+                return false;
+            return !stop;
+        }
+    private:
+        Basic::Scanner &m_s;
+    };
+};
+/*****************************************************************************/
+
 /*****************************************************************************/
 void Basic::scanExp(Symbolics::Basic::Scanner &s)
 /*****************************************************************************/
+{
+    ScanWalker walker(s);
+    walkExp(walker);
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+void Basic::walkExp(Symbolics::Basic::Walker &w) const
+/*****************************************************************************/
 {
     bool stop = false;
-    if (!s.process_Arg(BasicPtr(this),stop))
-      return;
-    if (stop)
-      return;
-    // iterate args
-    for (size_t i=0; i<getArgsSize(); ++i)
-      getArg(i)->scanExp(s);
+    if (!w.enter(this,stop) || stop)
+        return;
+    // Knoten und naechstes Argument
+    typedef std::pair<Basic const*, size_t> Frame;
+    std::vector<Frame> stack;
+    stack.reserve(32);
+    stack.push_back(Frame(this,0));
+    while (!stack.empty())
+    {
+        Frame &top = stack.back();
+        if (top.second < top.first->getArgsSize())
+        {
+            Basic const* arg = top.first->getArg(top.second++).get();
+            bool down = w.enter(arg,stop);
+            if (stop)
+                return;
+            if (down)
+                stack.push_back(Frame(arg,0));
+        }
+        else
+        {
+            Basic const* node = top.first;
+            stack.pop_back();
+            w.leave(node,stop);
+            if (stop)
+                return;
+        }
+    }
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+size_t Basic::calcHash() const
+/*****************************************************************************/
+{
+    // Typ und Argumente der Reihe nach
+    size_t hash = hashMix(static_cast<size_t>(m_type) + 1);
+    size_t argssize = getArgsSize();
+    for (size_t i=0; i<argssize; ++i)
+        hash = hashCombine(hash, getArg(i)->getHash());
+    return hash;
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+void Basic::hashChanged()
+/*****************************************************************************/
+{
+    // ein Parent kann nur einen gueltigen Hash (bzw. Atome) haben, wenn die
+    // Argumente einen gueltigen Hash haben, daher koennen wir dort aufhoeren
+    if (!m_hashValid && (m_atoms.get() == NULL))
+        return;
+    std::vector<Basic*> stack(1,this);
+    while (!stack.empty())
+    {
+        Basic *b = stack.back();
+        stack.pop_back();
+        if (!b->m_hashValid && (b->m_atoms.get() == NULL))
+            continue;
+        b->m_hashValid = false;
+        b->m_atoms = AtomListPtr();
+        for (ArgumentPtr ii = b->m_firstParent; ii != NULL; ii = ii->getNextParent())
+        {
+            if (ii->getParentPtr() != NULL)
+                stack.push_back(ii->getParentPtr());
+        }
+    }
 }
 /*****************************************************************************/
 
 /*****************************************************************************/
-void Basic::calcHash()
+void Basic::changed( std::vector<Basic*> &nodes )
 /*****************************************************************************/
 {
-    m_hash = 0;
+    if (nodes.empty())
+        return;
+    // neue Epoche, jeder Vorfahre wird nur einmal besucht
+    size_t epoch = ++m_epoch;
+    while (!nodes.empty())
+    {
+        Basic *b = nodes.back();
+        nodes.pop_back();
+        if (b->m_changedEpoch == epoch)
+            continue;
+        b->m_changedEpoch = epoch;
+        for (ArgumentPtr ii = b->m_firstParent; ii != NULL; ii = ii->getNextParent())
+        {
+            if (ii->getParentPtr() != NULL)
+                nodes.push_back(ii->getParentPtr());
+        }
+    }
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+size_t Basic::hashCombine( size_t seed, size_t hash )
+/*****************************************************************************/
+{
+    return seed ^ (hash + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+size_t Basic::hashMix( size_t hash )
+/*****************************************************************************/
+{
+    // Bits verteilen, damit auch die Summe (kommutative Argumente) gut streut
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6b;
+    hash ^= hash >> 13;
+    hash *= 0xc2b2ae35;
+    hash ^= hash >> 16;
+    return hash;
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+size_t Basic::hashNumber( double value )
+/*****************************************************************************/
+{
+    // -0.0 und 0.0 sind gleich
+    if (value == 0)
+        return hashMix(Type_Real + 1);
+    return hashMix(std::hash<double>()(value));
 }
 /*****************************************************************************/
 
@@ -165,6 +558,9 @@ BasicPtr Basic::solve(BasicPtr exp)
 
     if (exp->getType() == Type_Symbol)
     {
+      // exp kommt nicht vor, die Ableitung ist Null
+      if (!mayContain(exp.get()))
+          return Zero::getZero(m_shape);
       BasicPtr m_der = der(exp)->simplify();
       if (Util::is_Zero(m_der))
       {
@@ -172,7 +568,7 @@ BasicPtr Basic::solve(BasicPtr exp)
       }
 
       LookFor lookfor(exp);
-      m_der->scanExp(lookfor);
+      m_der->walkExp(lookfor);
       if (lookfor.found)
       {
           return BasicPtr();
@@ -192,10 +588,10 @@ BasicPtr Basic::solve(BasicPtr exp)
       {
         // check if a symbol from exp is in solve
         BasicSet atoms = exp->getAtoms();
-        LookForMultiple lookfor(atoms);
-        solve->scanExp(lookfor);
-        if (lookfor.found)
-          return BasicPtr();
+        BasicSet solveatoms = solve->getAtoms();
+        for (BasicSet::iterator ii = atoms.begin(); ii != atoms.end(); ++ii)
+          if (solveatoms.find(*ii) != solveatoms.end())
+            return BasicPtr();
         return solve;
       }
     }
@@ -203,7 +599,7 @@ BasicPtr Basic::solve(BasicPtr exp)
 /*****************************************************************************/
 
 /*****************************************************************************/
-bool Basic::LookFor::process_Arg(BasicPtr const &p, bool &stop)
+bool Basic::LookFor::enter(Basic const* p, bool &stop)
 /*****************************************************************************/
 {
     if (found)
@@ -211,7 +607,16 @@ bool Basic::LookFor::process_Arg(BasicPtr const &p, bool &stop)
         stop = true;
         return false;
     }
-    if (p==m_lookfor)
+    // Teilbaum ohne die Symbole von m_lookfor
+    if (!p->mayContain(m_lookfor.get()))
+        return false;
+    // gleiche Ausdruecke haben den gleichen Hash, nur dann genau vergleichen;
+    // verschiedene Typen koennen nur bei Zahlen und Matrizen gleich sein
+    Basic_Type type = m_lookfor->getType();
+    bool anytype = (type == Type_Zero) || (type == Type_Int) || (type == Type_Real) || (type == Type_Matrix);
+    if ((p == m_lookfor.get()) ||
+        ((anytype || (p->getType() == type)) && (p->getHash() == m_lookfor->getHash()) &&
+         (BasicPtr(const_cast<Basic*>(p)) == m_lookfor)))
     {
         found = true;
         stop = true;
@@ -222,7 +627,7 @@ bool Basic::LookFor::process_Arg(BasicPtr const &p, bool &stop)
 /*****************************************************************************/
 
 /*****************************************************************************/
-bool Basic::LookForMultiple::process_Arg(BasicPtr const &p, bool &stop)
+bool Basic::LookForMultiple::enter(Basic const* p, bool &stop)
 /*****************************************************************************/
 {
     if (found)
@@ -232,7 +637,7 @@ bool Basic::LookForMultiple::process_Arg(BasicPtr const &p, bool &stop)
     }
     if (p->getType() == Type_Symbol)
     {
-      if (m_lookfor.find(p) != m_lookfor.end())
+      if (m_lookfor.find(BasicPtr(const_cast<Basic*>(p))) != m_lookfor.end())
       {
           found = true;
           stop = true;
@@ -241,4 +646,24 @@ bool Basic::LookForMultiple::process_Arg(BasicPtr const &p, bool &stop)
     }
     return true;
 }
-/*****************************************************************************/
\ No newline at end of file
+/*****************************************************************************/
+
+/*****************************************************************************/
+namespace Symbolics
+{
+    // increment reference count of object *p
+    void intrusive_ptr_add_ref( const Symbolics::AtomList* p)
+    {
+        Symbolics::AtomList* a = const_cast<Symbolics::AtomList*>(p);
+        ++(a->m_refCount);
+    }
+
+    // decrement reference count, and delete object when reference count reaches 0
+    void intrusive_ptr_release( const Symbolics::AtomList* p)
+    {
+        Symbolics::AtomList* a = const_cast<Symbolics::AtomList*>(p);
+        if (--(a->m_refCount) == 0)
+            delete p;
+    }
+};
+/*****************************************************************************/
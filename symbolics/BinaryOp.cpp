@@ -59,9 +59,12 @@ bool BinaryOp::operator ==( Basic const& rhs) const
     if (getShape() != rhs.getShape())
       return false;
 
-    // Versuch zu casten
-    const BinaryOp *binary = dynamic_cast<const BinaryOp*>(&rhs);
-    if (binary == NULL) return false;
+    // verschiedener Hash, dann verschieden
+    if (getHash() != rhs.getHash())
+      return false;
+
+    // gleicher Typ, also auch BinaryOp
+    const BinaryOp *binary = static_cast<const BinaryOp*>(&rhs);
         
     return ((getArg1() == binary->getArg1()) && (getArg2() == binary->getArg2()));
 }
@@ -81,12 +84,13 @@ bool BinaryOp::operator<(Basic const& rhs) const
         return (getShape() < rhs.getShape());
 
     // UnaryOp
-    const BinaryOp &binaryop = dynamic_cast<const BinaryOp &>(rhs);
+    const BinaryOp &binaryop = static_cast<const BinaryOp &>(rhs);
     BasicPtr rhsArg1(binaryop.getArg1()); 
     BasicPtr rhsArg2(binaryop.getArg2()); 
 
-    // Args vergleichen
-    if ((*getArg1().get()) == (*rhsArg1.get()))
+    // Args vergleichen, gleicher Typ mit verschiedenem Hash ist sicher verschieden
+    if (((getArg1()->getType() != rhsArg1->getType()) || (getArg1()->getHash() == rhsArg1->getHash())) &&
+        ((*getArg1().get()) == (*rhsArg1.get())))
         return (*getArg2().get()) < (*rhsArg2.get());
     return (*getArg1().get()) < (*rhsArg1.get());
 }
@@ -115,13 +119,22 @@ BasicPtr BinaryOp::subs( ConstBasicPtr const& old_exp,
                        BasicPtr const& new_exp)
 /*****************************************************************************/
 {
+    Memo::Pass pass(subsMemo());
+    BasicPtr done = subsMemo().find(this);
+    if (done.get() != NULL)
+        return done;
+
+    // old_exp kann hier nicht vorkommen
+    if (!mayContain(old_exp.get()))
+        return BasicPtr(this);
+
     if (*this == *old_exp.get())
         return new_exp;
 
     // subs args
     BasicPtr subs_arg1 = getArg1()->subs(old_exp,new_exp);
     BasicPtr subs_arg2 = getArg2()->subs(old_exp,new_exp);
-    return Factory::newBasic( getType(), subs_arg1, subs_arg2, getShape() );
+    return subsMemo().insert(this, Factory::newBasic( getType(), subs_arg1, subs_arg2, getShape() ) );
 }
 /*****************************************************************************/
 
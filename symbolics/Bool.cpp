@@ -57,17 +57,17 @@ bool Bool::operator==(  Basic const& rhs ) const
     {
     case Type_Bool:
         {
-            const Bool &b = dynamic_cast<const Bool&>(rhs);
+            const Bool &b = static_cast<const Bool&>(rhs);
             return m_value == b.getValue();
         }
     case Type_Int:
         {
-            const Int &i = dynamic_cast<const Int&>(rhs);
+            const Int &i = static_cast<const Int&>(rhs);
             return m_value == (i.getValue()==0?false:true);
         }
     case Type_Real:
         {
-            const Real &r = dynamic_cast<const Real&>(rhs);
+            const Real &r = static_cast<const Real&>(rhs);
             return m_value == (r.getValue()==0.0?false:true);
         }
     default:
@@ -105,17 +105,17 @@ bool Bool::operator!=(  Basic const& rhs ) const
         }
     case Type_Bool:
         {
-            const Bool &b = dynamic_cast<const Bool&>(rhs);
+            const Bool &b = static_cast<const Bool&>(rhs);
             return m_value != b.getValue();
         }
     case Type_Int:
         {
-            const Int &i = dynamic_cast<const Int&>(rhs);
+            const Int &i = static_cast<const Int&>(rhs);
             return m_value != (i.getValue()==0?false:true);
         }
     case Type_Real:
         {
-            const Real &r = dynamic_cast<const Real&>(rhs);
+            const Real &r = static_cast<const Real&>(rhs);
             return m_value != (r.getValue()==0.0?false:true);
         }
     default:
@@ -137,17 +137,17 @@ bool Bool::operator<(  Basic const& rhs ) const
         }
     case Type_Int:
         {
-            const Int &i = dynamic_cast<const Int&>(rhs);
+            const Int &i = static_cast<const Int&>(rhs);
             return m_value < (i.getValue()==0?false:true);
         }
     case Type_Bool:
         {
-            const Bool &r = dynamic_cast<const Bool&>(rhs);
+            const Bool &r = static_cast<const Bool&>(rhs);
             return m_value < r.getValue();
         }
     case Type_Real:
         {
-            const Real &r = dynamic_cast<const Real&>(rhs);
+            const Real &r = static_cast<const Real&>(rhs);
             return m_value < (r.getValue()==0.0?false:true);
         }
     default:
@@ -53,17 +53,17 @@ bool Eye::operator==(  Basic const& rhs ) const
         return true;
     case Type_Int:
         {
-            const Int &i = dynamic_cast<const Int&>(rhs);
+            const Int &i = static_cast<const Int&>(rhs);
             return 0 == i.getValue();
         }
     case Type_Real:
         {
-            const Real &r = dynamic_cast<const Real&>(rhs);
+            const Real &r = static_cast<const Real&>(rhs);
             return 0 == r.getValue();
         }
     case Type_Matrix:
       {
-        const Matrix &mat = dynamic_cast<const Matrix&>(rhs);
+        const Matrix &mat = static_cast<const Matrix&>(rhs);
         if (mat.is_Vector())
         {
           size_t elem = mat.getShape().getNumEl();
@@ -111,7 +111,37 @@ BasicPtr Eye::getEye(Shape const& s)
 {
     if (s.getNumEl() == 1)
         return eye;
-    return BasicPtr(new Eye(s));
+    return getPooled(s);
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+// geteilte Knoten des aktuellen Scopes je Shape, die Tabelle selbst wird nie
+// freigegeben (Reihenfolge der statischen Destruktoren)
+static std::map<Shape,BasicPtr>& eyePool()
+/*****************************************************************************/
+{
+    static std::map<Shape,BasicPtr> &pool = *new std::map<Shape,BasicPtr>();
+    return pool;
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+void Eye::newScope()
+/*****************************************************************************/
+{
+    eyePool().clear();
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+BasicPtr const& Eye::getPooled(Shape const& s)
+/*****************************************************************************/
+{
+    BasicPtr &p = eyePool()[s];
+    if (p.get() == NULL)
+        p = BasicPtr(new Eye(s));
+    return p;
 }
 /*****************************************************************************/
 
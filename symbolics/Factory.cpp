@@ -3,6 +3,12 @@
 
 using namespace Symbolics;
 
+/*****************************************************************************/
+InternScopePtr Factory::m_scope = InternScopePtr(new InternScope());
+bool Factory::m_interning = true;
+size_t InternScope::m_simplifyMaxSize = 65536;
+/*****************************************************************************/
+
 /*****************************************************************************/
 Factory::Factory()
 /*****************************************************************************/
@@ -43,23 +49,23 @@ BasicPtr Factory::newBasic( Basic_Type type,  BasicPtr &arg, Shape const& shape)
     case Type_Der:
         return Der::New(arg);
     case Type_Atan:
-        return BasicPtr( new Atan(arg) );
+        return unique( BasicPtr( new Atan(arg) ) );
     case Type_Abs:
-        return BasicPtr( new Abs(arg) );
+        return unique( BasicPtr( new Abs(arg) ) );
     case Type_Acos:
-        return BasicPtr( new Acos(arg) );
+        return unique( BasicPtr( new Acos(arg) ) );
     case Type_Asin:
-        return BasicPtr( new Asin(arg) );
+        return unique( BasicPtr( new Asin(arg) ) );
     case Type_Scalar:
-        return BasicPtr( new Scalar(arg) );
+        return unique( BasicPtr( new Scalar(arg) ) );
     case Type_Skew:
         return Skew::New(arg);
     case Type_Transpose:
-        return BasicPtr( new Transpose(arg) );
+        return unique( BasicPtr( new Transpose(arg) ) );
     case Type_Unknown:
         throw InternalError("Unknown is not supported by Factory!");
     case Type_Tan:
-        return BasicPtr( new Tan(arg) );
+        return unique( BasicPtr( new Tan(arg) ) );
     default:
         throw InternalError("Unknown Type: " + str(type) + "!");
     };
@@ -83,17 +89,17 @@ BasicPtr Factory::newBasic( Basic_Type type,  BasicPtr &arg1, BasicPtr &arg2, Sh
     case Type_Mul:
         return Mul::New(arg1,arg2);
     case Type_Pow:
-        return BasicPtr( new Pow(arg1,arg2) );
+        return unique( BasicPtr( new Pow(arg1,arg2) ) );
     case Type_Solve:
-        return BasicPtr( new Solve(arg1,arg2) );
+        return unique( BasicPtr( new Solve(arg1,arg2) ) );
     case Type_Atan2:
-        return BasicPtr( new Atan2(arg1,arg2) );
+        return unique( BasicPtr( new Atan2(arg1,arg2) ) );
     case Type_Less:
-        return BasicPtr( new Less(arg1,arg2) );
+        return unique( BasicPtr( new Less(arg1,arg2) ) );
     case Type_Greater:
-        return BasicPtr( new Greater(arg1,arg2) );
+        return unique( BasicPtr( new Greater(arg1,arg2) ) );
     case Type_Equal:
-        return BasicPtr( new Equal(arg1,arg2) );
+        return unique( BasicPtr( new Equal(arg1,arg2) ) );
     case Type_Unknown:
         throw InternalError("Unknown is not supported by Factory!");
     default:
@@ -115,55 +121,273 @@ BasicPtr Factory::newBasic( Basic_Type type,  BasicPtrVec &args, Shape const& sh
     case Type_Real:
         throw InternalError("Real is not supported by Factory!");
     case Type_Matrix:
+        // Matrizen sind veraenderbar (set, +=, ...), werden nicht geteilt
         return BasicPtr( new Matrix( args, shape ) );
     case Type_Neg:
-        return BasicPtr( new Neg(args) );
+        return unique( BasicPtr( new Neg(args) ) );
     case Type_Add:
-        return BasicPtr( new Add(args) );//->simplify();
+        return unique( BasicPtr( new Add(args) ) );
     case Type_Mul:
-        return BasicPtr( new Mul(args) );//->simplify();
+        return unique( BasicPtr( new Mul(args) ) );
     case Type_Pow:
-        return BasicPtr( new Pow(args) );
+        return unique( BasicPtr( new Pow(args) ) );
     case Type_Sin:
-        return BasicPtr( new Sin(args) );
+        return unique( BasicPtr( new Sin(args) ) );
     case Type_Cos:
-        return BasicPtr( new Cos(args) );
+        return unique( BasicPtr( new Cos(args) ) );
     case Type_Der:
-        return BasicPtr( new Der(args) );
+        return unique( BasicPtr( new Der(args) ) );
     case Type_Element:
-        return BasicPtr( new Element(args) );
+        return unique( BasicPtr( new Element(args) ) );
     case Type_Atan:
-        return BasicPtr( new Atan(args) );
+        return unique( BasicPtr( new Atan(args) ) );
     case Type_Solve:
-        return BasicPtr( new Solve(args) );
+        return unique( BasicPtr( new Solve(args) ) );
     case Type_Atan2:
-        return BasicPtr( new Atan2(args) );
+        return unique( BasicPtr( new Atan2(args) ) );
     case Type_Abs:
-        return BasicPtr( new Abs(args) );
+        return unique( BasicPtr( new Abs(args) ) );
     case Type_Acos:
-        return BasicPtr( new Acos(args) );
+        return unique( BasicPtr( new Acos(args) ) );
     case Type_Asin:
-        return BasicPtr( new Asin(args) );
+        return unique( BasicPtr( new Asin(args) ) );
     case Type_Scalar:
-        return BasicPtr( new Scalar(args) );
+        return unique( BasicPtr( new Scalar(args) ) );
     case Type_Skew:
-        return BasicPtr( new Skew(args) );
+        return unique( BasicPtr( new Skew(args) ) );
     case Type_Transpose:
-        return BasicPtr( new Transpose(args) );
+        return unique( BasicPtr( new Transpose(args) ) );
     case Type_Less:
-        return BasicPtr( new Less(args) );
+        return unique( BasicPtr( new Less(args) ) );
     case Type_Greater:
-        return BasicPtr( new Greater(args) );
+        return unique( BasicPtr( new Greater(args) ) );
     case Type_Equal:
-        return BasicPtr( new Equal(args) );
+        return unique( BasicPtr( new Equal(args) ) );
     case Type_If:
-        return BasicPtr( new If(args) );
+        return unique( BasicPtr( new If(args) ) );
     case Type_Unknown:
         throw InternalError("Unknown is not supported by Factory!");
     case Type_Tan:
-        return BasicPtr( new Tan(args) );
+        return unique( BasicPtr( new Tan(args) ) );
     default:
         throw InternalError("Unknown Type: " + str(type) + "!");
     };
 }
 /*****************************************************************************/
+
+/*****************************************************************************/
+BasicPtr Factory::unique( BasicPtr const& basic )
+/*****************************************************************************/
+{
+    if (!m_interning)
+        return basic;
+    Basic *b = basic.get();
+    if (b == NULL)
+        throw InternalError("Factory::unique: get() returned NULL!");
+    // schon geteilt
+    if (b->m_internScope.get() != NULL)
+        return basic;
+    // Matrix und SymmetricMatrix koennen nachtraeglich geaendert werden
+    if (b->getType() == Type_Matrix)
+        return basic;
+
+    size_t key = internKey(b);
+    Basic *found = m_scope->find(key,b);
+    if (found != NULL)
+        return BasicPtr(found);
+
+    // eintragen
+    m_scope->insert(key,b);
+    b->m_internScope = m_scope;
+    b->m_internKey = key;
+    return basic;
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+// Schluessel fuer Argumente: Konstanten nach Wert, alles andere nach Adresse,
+// da die Argumente selbst schon geteilt sind
+static inline size_t argKey( Basic const* arg )
+/*****************************************************************************/
+{
+    switch (arg->getType())
+    {
+    case Type_Int:
+        return static_cast<size_t>(static_cast<const Int*>(arg)->getValue());
+    case Type_Real:
+        return std::hash<double>()(static_cast<const Real*>(arg)->getValue());
+    default:
+        return reinterpret_cast<size_t>(arg);
+    }
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+static inline bool sameArg( Basic const* lhs, Basic const* rhs )
+/*****************************************************************************/
+{
+    if (lhs == rhs)
+        return true;
+    if (lhs->getType() != rhs->getType())
+        return false;
+    switch (lhs->getType())
+    {
+    case Type_Int:
+        return static_cast<const Int*>(lhs)->getValue() == static_cast<const Int*>(rhs)->getValue();
+    case Type_Real:
+        return static_cast<const Real*>(lhs)->getValue() == static_cast<const Real*>(rhs)->getValue();
+    default:
+        return false;
+    }
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+size_t Factory::internKey( Basic const* basic )
+/*****************************************************************************/
+{
+    Shape const& shape = basic->getShape();
+    size_t key = static_cast<size_t>(basic->getType());
+    key = 65599 * key + shape.getNrDimensions();
+    key = 65599 * key + shape.getDimension(1);
+    key = 65599 * key + shape.getDimension(2);
+    size_t argssize = basic->getArgsSize();
+    for (size_t i=0; i<argssize; ++i)
+        key = 65599 * key + argKey(basic->getArg(i).get());
+    return key;
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+Basic* InternScope::find( size_t key, Basic const* basic ) const
+/*****************************************************************************/
+{
+    std::pair<InternTable::const_iterator, InternTable::const_iterator> range = m_table.equal_range(key);
+    size_t argssize = basic->getArgsSize();
+    for (InternTable::const_iterator ii=range.first; ii!=range.second; ++ii)
+    {
+        // Knoten koennen seit dem Eintragen veraendert worden sein (simplify, subs),
+        // daher immer gegen den aktuellen Zustand pruefen
+        Basic *c = ii->second;
+        if (c->getType() != basic->getType())
+            continue;
+        if (c->getShape() != basic->getShape())
+            continue;
+        if (c->getArgsSize() != argssize)
+            continue;
+        bool equal = true;
+        for (size_t i=0; (i<argssize) && equal; ++i)
+            equal = sameArg(c->getArg(i).get(), basic->getArg(i).get());
+        if (equal)
+            return c;
+    }
+    return NULL;
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+void InternScope::insert( size_t key, Basic *basic )
+/*****************************************************************************/
+{
+    m_table.insert(InternTable::value_type(key,basic));
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+void InternScope::remove( size_t key, Basic const* basic )
+/*****************************************************************************/
+{
+    std::pair<InternTable::iterator, InternTable::iterator> range = m_table.equal_range(key);
+    for (InternTable::iterator ii=range.first; ii!=range.second; ++ii)
+    {
+        if (ii->second == basic)
+        {
+            m_table.erase(ii);
+            return;
+        }
+    }
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+BasicPtr InternScope::findSimplified( size_t key, Basic const* basic )
+/*****************************************************************************/
+{
+    std::pair<SimplifyTable::const_iterator, SimplifyTable::const_iterator> range = m_simplifyTable.equal_range(key);
+    size_t argssize = basic->getArgsSize();
+    for (SimplifyTable::const_iterator ii=range.first; ii!=range.second; ++ii)
+    {
+        SimplifyEntry const& e = ii->second;
+        if (e.type != basic->getType())
+            continue;
+        if (e.shape != basic->getShape())
+            continue;
+        if (e.args.size() != argssize)
+            continue;
+        bool equal = true;
+        for (size_t i=0; (i<argssize) && equal; ++i)
+        {
+            Basic const* arg = basic->getArg(i).get();
+            equal = sameArg(e.args[i].get(), arg) ||
+                    ((e.args[i]->getHash() == arg->getHash()) && (*e.args[i] == *arg));
+        }
+        if (equal)
+        {
+            ++m_simplifyHits;
+            return e.result;
+        }
+    }
+    ++m_simplifyMisses;
+    return BasicPtr();
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+void InternScope::insertSimplified( size_t key, Basic_Type type, Shape const& shape, BasicPtrVec const& args, BasicPtr const& result )
+/*****************************************************************************/
+{
+    if (m_simplifyMaxSize == 0)
+        return;
+    // voll, dann die Referenzen auf alte Argumente und Ergebnisse freigeben
+    if (m_simplifyTable.size() >= m_simplifyMaxSize)
+        m_simplifyTable.clear();
+    SimplifyEntry e;
+    e.type = type;
+    e.shape = shape;
+    e.args = args;
+    e.result = result;
+    m_simplifyTable.insert(SimplifyTable::value_type(key,e));
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+void InternScope::setSimplifySize( const size_t size )
+/*****************************************************************************/
+{
+    // gilt fuer alle Scopes, der aktuelle wird gleich gekuerzt
+    m_simplifyMaxSize = size;
+    InternScope *scope = Factory::getScope().get();
+    if (scope->m_simplifyTable.size() > size)
+        scope->m_simplifyTable.clear();
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+namespace Symbolics
+{
+    // increment reference count of object *p
+    void intrusive_ptr_add_ref( const Symbolics::InternScope* p)
+    {
+        Symbolics::InternScope* s = const_cast<Symbolics::InternScope*>(p);
+        ++(s->m_refCount);
+    }
+
+    // decrement reference count, and delete object when reference count reaches 0
+    void intrusive_ptr_release( const Symbolics::InternScope* p)
+    {
+        Symbolics::InternScope* s = const_cast<Symbolics::InternScope*>(p);
+        if (--(s->m_refCount) == 0)
+            delete p;
+    }
+};
+/*****************************************************************************/
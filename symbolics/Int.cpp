@@ -10,6 +10,19 @@ using namespace Symbolics;
  BasicPtr Int::one = BasicPtr( new Int(1) );
  BasicPtr Int::minusOne = BasicPtr( new Int(-1) );
  BasicPtr Int::getArgres;
+ int Int::m_poolMin = -128;
+ int Int::m_poolMax = 1024;
+/*****************************************************************************/
+
+/*****************************************************************************/
+// geteilte Ints des aktuellen Scopes, der Vektor selbst wird nie freigegeben
+// (Reihenfolge der statischen Destruktoren)
+static std::vector<BasicPtr>& intPool()
+/*****************************************************************************/
+{
+  static std::vector<BasicPtr> &pool = *new std::vector<BasicPtr>();
+  return pool;
+}
 /*****************************************************************************/
 
 
@@ -41,8 +54,37 @@ BasicPtr Int::New( const int i)
     case 1:
         return Int::getOne();
     default:
-        return BasicPtr(new Int(i));
+        break;
     }
+    // ausserhalb des Pools immer neu anlegen
+    if ((i < m_poolMin) || (i > m_poolMax))
+        return BasicPtr(new Int(i));
+    std::vector<BasicPtr> &pool = intPool();
+    if (pool.empty())
+        pool.resize(static_cast<size_t>(m_poolMax - m_poolMin) + 1);
+    BasicPtr &p = pool[i - m_poolMin];
+    if (p.get() == NULL)
+        p = BasicPtr(new Int(i));
+    return p;
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+void Int::setPoolRange( const int min, const int max )
+/*****************************************************************************/
+{
+    // bestehende Knoten bleiben gueltig, der Pool wird neu aufgebaut
+    intPool().clear();
+    m_poolMin = min;
+    m_poolMax = max;
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+void Int::newScope()
+/*****************************************************************************/
+{
+    intPool().clear();
 }
 /*****************************************************************************/
 
@@ -84,17 +126,17 @@ bool Int::operator==(  Basic const& rhs ) const
         }
     case Type_Bool:
         {
-            const Bool &b = dynamic_cast<const Bool&>(rhs);
+            const Bool &b = static_cast<const Bool&>(rhs);
             return (m_value==0?false:true) == b.getValue();
         }
     case Type_Int:
         {
-            const Int &i = dynamic_cast<const Int&>(rhs);
+            const Int &i = static_cast<const Int&>(rhs);
             return m_value == i.getValue();
         }
     case Type_Real:
         {
-            const Real &r = dynamic_cast<const Real&>(rhs);
+            const Real &r = static_cast<const Real&>(rhs);
             return m_value == r.getValue();
         }
     default:
@@ -133,17 +175,17 @@ bool Int::operator!=(  Basic const& rhs ) const
         }
     case Type_Bool:
         {
-            const Bool &b = dynamic_cast<const Bool&>(rhs);
+            const Bool &b = static_cast<const Bool&>(rhs);
             return (m_value==0?false:true) != b.getValue();
         }
     case Type_Int:
         {
-            const Int &i = dynamic_cast<const Int&>(rhs);
+            const Int &i = static_cast<const Int&>(rhs);
             return m_value != i.getValue();
         }
     case Type_Real:
         {
-            const Real &r = dynamic_cast<const Real&>(rhs);
+            const Real &r = static_cast<const Real&>(rhs);
             return m_value != r.getValue();
         }
     default:
@@ -165,17 +207,17 @@ bool Int::operator<(  Basic const& rhs ) const
         }
     case Type_Bool:
         {
-            const Bool &b = dynamic_cast<const Bool&>(rhs);
+            const Bool &b = static_cast<const Bool&>(rhs);
             return (m_value==0?false:true) < b.getValue();
         }
     case Type_Int:
         {
-            const Int &i = dynamic_cast<const Int&>(rhs);
+            const Int &i = static_cast<const Int&>(rhs);
             return m_value < i.getValue();
         }
     case Type_Real:
         {
-            const Real &r = dynamic_cast<const Real&>(rhs);
+            const Real &r = static_cast<const Real&>(rhs);
             return m_value < r.getValue();
         }
     default:
@@ -10,6 +10,42 @@
 #include "str.h"
 using namespace Symbolics;
 
+namespace
+{
+    /*****************************************************************************/
+    // Besetzungsmuster einer Matrix zeilenweise (CSR ohne Werte): die Spalten
+    // der Nicht-Nullen von Zeile m stehen in cols[rowStart[m]..rowStart[m+1])
+    struct SparsePattern
+    {
+        std::vector<size_t> rowStart;
+        std::vector<size_t> cols;
+
+        // false, wenn ein Element kein Skalar ist, dann gilt das Muster nicht
+        bool build( Matrix const& mat )
+        {
+            size_t rows = mat.getShape().getDimension(1);
+            size_t dim2 = mat.getShape().getDimension(2);
+            rowStart.assign(1, 0);
+            rowStart.reserve(rows+1);
+            cols.clear();
+            for (size_t m=0; m<rows; ++m)
+            {
+                for (size_t n=0; n<dim2; ++n)
+                {
+                    BasicPtr const& el = mat(m,n);
+                    if (!el->is_Scalar())
+                        return false;
+                    if (!Util::is_Zero(el))
+                        cols.push_back(n);
+                }
+                rowStart.push_back(cols.size());
+            }
+            return true;
+        }
+    };
+    /*****************************************************************************/
+};
+
 
 /*****************************************************************************/
 Matrix::Matrix(  Shape const& shape, bool fillZeros ): NaryOp(Type_Matrix, BasicPtrVec())
@@ -110,9 +146,9 @@ std::string Matrix::toString() const
 BasicPtr Matrix::simplify()
 /*****************************************************************************/
 {
-    if (m_simplified)
+    if (is_Simplified())
         return BasicPtr(this);
-    m_simplified = true;
+    setSimplified(true);
     // Argument vereinfachen
     simplifyArgs();
     return BasicPtr(this);
@@ -124,6 +160,11 @@ BasicPtr Matrix::simplify()
  BasicPtr Matrix::iterateExp(Symbolics::Basic::Iterator &v)
 /*****************************************************************************/
 {
+    Memo::Pass pass(v.memo);
+    BasicPtr done = v.memo.find(this);
+    if (done.get() != NULL)
+        return done;
+
     // iterate args
     BasicPtrVec iter_args;
     iter_args.reserve(getArgsSize());
@@ -131,7 +172,7 @@ BasicPtr Matrix::simplify()
     {
         iter_args.push_back(getArg(i)->iterateExp(v));
     }
-    return v.process_Arg(BasicPtr(new Matrix(iter_args, m_shape)));
+    return v.memo.insert(this, v.process_Arg(BasicPtr(new Matrix(iter_args, m_shape))));
 }
 /*****************************************************************************/
 
@@ -141,11 +182,14 @@ bool Matrix::operator==( Basic const& rhs) const
 {
   // Versuch zu casten
     if (rhs.getType() != Type_Matrix) return false;
-    const Matrix &mat = dynamic_cast<const Matrix&>(rhs);
+    const Matrix &mat = static_cast<const Matrix&>(rhs);
 
     // Speichergroesse vergleichen
     if (m_shape != mat.getShape()) return false;
 
+    // verschiedener Hash, dann verschieden
+    if (getHash() != mat.getHash()) return false;
+
     // Werte vergleichen
     size_t rows = m_shape.getDimension(1);
     size_t cols = m_shape.getDimension(2);
@@ -163,6 +207,34 @@ bool Matrix::operator==( Basic const& rhs) const
 }
 /*****************************************************************************/
 
+/*****************************************************************************/
+size_t Matrix::calcHash() const
+/*****************************************************************************/
+{
+    // Eine Matrix aus Nullen ist gleich Zero, dann auch gleicher Hash
+    size_t zeroHash = hashNumber(0);
+    bool zeros = true;
+    size_t hash = hashMix(static_cast<size_t>(m_type) + 1);
+    hash = hashCombine(hash, m_shape.getNrDimensions());
+    size_t rows = m_shape.getDimension(1);
+    size_t cols = m_shape.getDimension(2);
+    hash = hashCombine(hash, rows);
+    hash = hashCombine(hash, cols);
+    for (size_t m=0; m<rows; ++m)
+    {
+        for (size_t n=0; n<cols; ++n)
+        {
+            size_t elementHash = getArg(getIndex(m,n))->getHash();
+            zeros = zeros && (elementHash == zeroHash);
+            hash = hashCombine(hash, elementHash);
+        }
+    }
+    if (zeros)
+        return zeroHash;
+    return hash;
+}
+/*****************************************************************************/
+
 
 /*****************************************************************************/
 bool Matrix::operator<(Basic const& rhs) const
@@ -177,7 +249,7 @@ bool Matrix::operator<(Basic const& rhs) const
         return (getShape() < rhs.getShape());
 
     // Versuch zu casten
-    const Matrix& mat = dynamic_cast<const Matrix&>(rhs);
+    const Matrix& mat = static_cast<const Matrix&>(rhs);
 
     // Speichergroesse vergleichen
     if (m_shape != mat.getShape()) 
@@ -258,7 +330,7 @@ Matrix Matrix::operator+( Real const& rhs) const
 Matrix& Matrix::operator+=( Matrix const& rhs)
 /*****************************************************************************/
 {
-     m_simplified = false;
+     setSimplified(false);
     // Neuen Shape berechnen, koennte eine Exception werfen
      Shape newShape( m_shape+rhs.m_shape );
 
@@ -373,7 +445,7 @@ Matrix Matrix::operator-( Real const& rhs) const
 Matrix& Matrix::operator-=( Matrix const& rhs)
 /*****************************************************************************/
 {
-    m_simplified = false;
+    setSimplified(false);
     // Neuen Shape berechnen, koennte eine Exception werfen
     Shape newShape( m_shape+rhs.m_shape );
 
@@ -488,7 +560,7 @@ Matrix Matrix::operator*( Real const& rhs) const
 Matrix& Matrix::operator*=( Matrix const& rhs)
 /*****************************************************************************/
 {
-    m_simplified = false;
+    setSimplified(false);
     // Neuen Shape berechnen, koennte eine Exception werfen
     Shape newShape( m_shape*rhs.m_shape );
 
@@ -550,15 +622,42 @@ Matrix& Matrix::operator*=( Matrix const& rhs)
     size_t dim1 = m_shape.getDimension(1);
     size_t dimInner = m_shape.getDimension(2);    // == rhs.m_shape.getDimension(1)
     size_t dim2 = rhs.m_shape.getDimension(2);
-    // Werte berechnen
-    for (size_t m=0;m<dim1;++m)
+    // Besetzungsmuster, Produkte mit einer skalaren Null liefern Null und
+    // aendern die Summe nicht, es werden nur die Nicht-Nullen multipliziert
+    SparsePattern lhsPattern, rhsPattern;
+    if (lhsPattern.build(*this) && rhsPattern.build(rhs))
     {
-        for(size_t n=0;n<dim2;++n)
+        BasicPtrVec row;
+        for (size_t m=0;m<dim1;++m)
         {
-            BasicPtr val = Zero::getZero();
-            for(size_t i=0; i<dimInner; ++i)
-                val = val + get(m,i)*rhs(i,n);
-            newArgs.push_back(val);
+            row.assign(dim2, Zero::getZero());
+            // Summanden je Element weiterhin mit aufsteigendem i
+            for (size_t ii=lhsPattern.rowStart[m]; ii<lhsPattern.rowStart[m+1]; ++ii)
+            {
+                size_t i = lhsPattern.cols[ii];
+                BasicPtr const& a = get(m,i);
+                for (size_t nn=rhsPattern.rowStart[i]; nn<rhsPattern.rowStart[i+1]; ++nn)
+                {
+                    size_t n = rhsPattern.cols[nn];
+                    row[n] = row[n] + a*rhs(i,n);
+                }
+            }
+            for(size_t n=0;n<dim2;++n)
+                newArgs.push_back(row[n]);
+        }
+    }
+    else
+    {
+        // Werte berechnen
+        for (size_t m=0;m<dim1;++m)
+        {
+            for(size_t n=0;n<dim2;++n)
+            {
+                BasicPtr val = Zero::getZero();
+                for(size_t i=0; i<dimInner; ++i)
+                    val = val + get(m,i)*rhs(i,n);
+                newArgs.push_back(val);
+            }
         }
     }
     clearArgs();
@@ -632,7 +731,7 @@ Matrix& Matrix::operator/=( double rhs)
 Matrix::Inserter Matrix::operator=( BasicPtr const& a)
 /*****************************************************************************/
 {
-    m_simplified = false;
+    setSimplified(false);
     // Wert speichern und Inserter zurueckgeben
     return Inserter(*this, a);
 }
@@ -655,7 +754,7 @@ Matrix::Inserter Matrix::operator=( double a)
 /*****************************************************************************/
 {
     // Wert speichern und Inserter zurueckgeben
-    BasicPtr r(new Real(a));
+    BasicPtr r(Real::New(a));
     return Inserter(*this, r);
 }
 /*****************************************************************************/
@@ -724,7 +823,7 @@ Matrix::Inserter& Matrix::Inserter::operator,( double a)
 /*****************************************************************************/
 {
     // Wert speichern und uns selbst zurueckgeben
-    BasicPtr r(new Real(a));
+    BasicPtr r(Real::New(a));
     insert(r);
     return *this;
 }
@@ -760,7 +859,7 @@ void Matrix::set( size_t zeroBasedRow,  size_t zeroBasedCol, BasicPtr const& arg
     size_t i = getIndex(zeroBasedRow,zeroBasedCol);
     if (i >= getNumEl())
         throw IndexError("Index out of bounds!");
-    m_simplified = false;
+    setSimplified(false);
     setArg(i,arg);
 }
 /*****************************************************************************/
@@ -772,7 +871,7 @@ void Matrix::set( size_t zeroBasedRow, BasicPtr const& arg)
 {
     if (zeroBasedRow >= getNumEl())
         throw IndexError("Index out of bounds!");
-    m_simplified = false;
+    setSimplified(false);
     setArg(zeroBasedRow,arg);
 }
 /*****************************************************************************/
@@ -788,16 +887,16 @@ Matrix Matrix::transpose() const
         return *this;
     }
 
-    // Sonst halt alles drehen
-    Matrix tmp( m_shape.transpose() );
-
-    // Nun alles kopieren
-    for( size_t m=0; m<m_shape.getDimension(1); m++)
-        for( size_t n=0; n<m_shape.getDimension(2); n++)
-            tmp.set(n,m,get(m,n));
+    // Elemente in transponierter Reihenfolge einsammeln, ohne die neue
+    // Matrix erst mit Nullen zu fuellen
+    BasicPtrVec values;
+    values.reserve( getNumEl() );
+    for( size_t n=0; n<m_shape.getDimension(2); n++)
+        for( size_t m=0; m<m_shape.getDimension(1); m++)
+            values.push_back(get(m,n));
 
     // fertig
-    return tmp;
+    return Matrix( values, m_shape.transpose() );
 }
 /*****************************************************************************/
 
@@ -823,7 +922,7 @@ Matrix Matrix::operator-() const
  Matrix& Matrix::operator=(  Matrix const& mat )
 /*****************************************************************************/
 {
-    m_simplified = false;
+    setSimplified(false);
     // Shape aendern und NICHT mit Nullen fuellen
     changeShape( mat.getShape(), false );        
 
@@ -844,7 +943,7 @@ BasicPtr Matrix::der()
 /*****************************************************************************/
 {
     // lehre matrix
-    Matrix *tmp = new Matrix( m_shape );
+    Matrix *tmp = newMatrix();
 
     // Nun alles differenzieren
     for(size_t i=0; i<getNumEl(); ++i)
@@ -860,7 +959,7 @@ BasicPtr Matrix::der(BasicPtr const& symbol)
 /*****************************************************************************/
 {
     // lehre matrix
-    Matrix *tmp = new Matrix( m_shape );
+    Matrix *tmp = newMatrix();
 
     // Nun alles differenzieren
     for(size_t i=0; i<getNumEl(); ++i)
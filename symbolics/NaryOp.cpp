@@ -4,6 +4,26 @@
 using namespace Symbolics;
 
 
+/*****************************************************************************/
+void ArgumentSmallVec::reserve( size_t n )
+/*****************************************************************************/
+{
+    if (n <= m_capacity)
+        return;
+    Argument *data = static_cast<Argument*>(::operator new(n*sizeof(Argument)));
+    // Kopie haengt sich in die Parentliste ein, das Original aus
+    for (size_t i=0; i<m_size; ++i)
+    {
+        new (data + i) Argument(m_data[i]);
+        m_data[i].~Argument();
+    }
+    if (m_data != inlineData())
+        ::operator delete(m_data);
+    m_data = data;
+    m_capacity = n;
+}
+/*****************************************************************************/
+
 /*****************************************************************************/
 NaryOp::NaryOp( Basic_Type type,  BasicPtrVec const& args):
 Basic(type)
@@ -114,9 +134,12 @@ bool NaryOp::operator ==( Basic const& rhs) const
     if (getShape() != rhs.getShape())
       return false;
 
-    // Versuch zu casten
-    const NaryOp *nary = dynamic_cast<const NaryOp*>(&rhs);
-    if (nary == NULL) return false;
+    // verschiedener Hash, dann verschieden
+    if (getHash() != rhs.getHash())
+      return false;
+
+    // gleicher Typ, also auch NaryOp
+    const NaryOp *nary = static_cast<const NaryOp*>(&rhs);
 
     // Anzahl der Argumente pruefen
     if (m_args.size() != nary->m_args.size()) return false;
@@ -142,15 +165,16 @@ bool NaryOp::operator<(Basic  const& rhs) const
     if (getShape() != rhs.getShape())
         return (getShape() < rhs.getShape());
     // UnaryOp
-    const NaryOp &naryop = dynamic_cast<const NaryOp &>(rhs);
+    const NaryOp &naryop = static_cast<const NaryOp &>(rhs);
 
     if (m_args.size() == naryop.m_args.size())
     {
         for (size_t i=0;i<m_args.size();++i)
         {
             BasicPtr rhsArg(naryop.getArg(i)); 
-            // Args vergleichen
-            if ((*getArg(i).get()) == (*rhsArg.get()))
+            // Args vergleichen, gleicher Typ mit verschiedenem Hash ist sicher verschieden
+            if (((getArg(i)->getType() != rhsArg->getType()) || (getArg(i)->getHash() == rhsArg->getHash())) &&
+                ((*getArg(i).get()) == (*rhsArg.get())))
                 continue;
             return (*getArg(i).get()) < (*rhsArg.get());
         }
@@ -185,6 +209,15 @@ void NaryOp::getAtoms(Basic::BasicSizeTMap& atoms)
                        BasicPtr const& new_exp)
 /*****************************************************************************/
 {
+    Memo::Pass pass(subsMemo());
+    BasicPtr done = subsMemo().find(this);
+    if (done.get() != NULL)
+        return done;
+
+    // old_exp kann hier nicht vorkommen
+    if (!mayContain(old_exp.get()))
+        return BasicPtr(this);
+
     if (*this == *old_exp.get())
         return new_exp;
 
@@ -194,7 +227,7 @@ void NaryOp::getAtoms(Basic::BasicSizeTMap& atoms)
     for (size_t i=0; i<m_args.size(); ++i)
             subs_args.push_back(getArg(i)->subs(old_exp,new_exp));
 
-    return Factory::newBasic( getType(), subs_args, getShape() );
+    return subsMemo().insert(this, Factory::newBasic( getType(), subs_args, getShape() ) );
 }
 /*****************************************************************************/
 
@@ -3,11 +3,63 @@
 #include "Util.h"
 #include "Operators.h"
 #include "Matrix.h"
+#include <string.h>
 
 using namespace Symbolics;
 
 /*****************************************************************************/
 BasicPtr Real::getArgres;
+size_t Real::m_poolSize = 4096;
+/*****************************************************************************/
+
+/*****************************************************************************/
+// geteilte Reals des aktuellen Scopes nach Bitmuster (0.0 und -0.0 bleiben
+// verschieden), die Tabelle selbst wird nie freigegeben (Reihenfolge der
+// statischen Destruktoren)
+typedef std::unordered_map<unsigned long long, BasicPtr> RealPool;
+static RealPool& realPool()
+/*****************************************************************************/
+{
+  static RealPool &pool = *new RealPool();
+  return pool;
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+BasicPtr Real::New( const double r )
+/*****************************************************************************/
+{
+    unsigned long long bits = 0;
+    memcpy(&bits, &r, sizeof(r));
+    RealPool &pool = realPool();
+    RealPool::iterator ii = pool.find(bits);
+    if (ii != pool.end())
+        return ii->second;
+    BasicPtr p(new Real(r));
+    // Pool voll, dann nicht mehr teilen
+    if (pool.size() < m_poolSize)
+        pool[bits] = p;
+    return p;
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+void Real::setPoolSize( const size_t size )
+/*****************************************************************************/
+{
+    // bestehende Knoten bleiben gueltig
+    if (realPool().size() > size)
+        realPool().clear();
+    m_poolSize = size;
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+void Real::newScope()
+/*****************************************************************************/
+{
+    realPool().clear();
+}
 /*****************************************************************************/
 
 /*****************************************************************************/
@@ -70,17 +122,17 @@ bool Real::operator==(  Basic const& rhs ) const
         }
     case Type_Bool:
         {
-            const Bool &b = dynamic_cast<const Bool&>(rhs);
+            const Bool &b = static_cast<const Bool&>(rhs);
             return (m_value==0.0?false:true) == b.getValue();
         }
     case Type_Int:
         {
-            const Int &i = dynamic_cast<const Int&>(rhs);
+            const Int &i = static_cast<const Int&>(rhs);
             return m_value == i.getValue();
         }
     case Type_Real:
         {
-            const Real &r = dynamic_cast<const Real&>(rhs);
+            const Real &r = static_cast<const Real&>(rhs);
             return m_value == r.getValue();
         }
     default:
@@ -119,17 +171,17 @@ bool Real::operator!=(  Basic const& rhs ) const
         }
     case Type_Bool:
         {
-            const Bool &b = dynamic_cast<const Bool&>(rhs);
+            const Bool &b = static_cast<const Bool&>(rhs);
             return (m_value==0.0?false:true) != b.getValue();
         }
     case Type_Int:
         {
-            const Int &i = dynamic_cast<const Int&>(rhs);
+            const Int &i = static_cast<const Int&>(rhs);
             return m_value != i.getValue();
         }
     case Type_Real:
         {
-            const Real &r = dynamic_cast<const Real&>(rhs);
+            const Real &r = static_cast<const Real&>(rhs);
             return m_value != r.getValue();
         }
     default:
@@ -151,17 +203,17 @@ bool Real::operator<(  Basic const& rhs ) const
         }
     case Type_Bool:
         {
-            const Bool &b = dynamic_cast<const Bool&>(rhs);
+            const Bool &b = static_cast<const Bool&>(rhs);
             return (m_value==0.0?false:true) < b.getValue();
         }
     case Type_Int:
         {
-            const Int &i = dynamic_cast<const Int&>(rhs);
+            const Int &i = static_cast<const Int&>(rhs);
             return m_value < i.getValue();
         }
     case Type_Real:
         {
-            const Real &r = dynamic_cast<const Real&>(rhs);
+            const Real &r = static_cast<const Real&>(rhs);
             return m_value < r.getValue();
         }
     default:
@@ -17,13 +17,50 @@ std::set<std::string> Symbol::symbol_names;
 BasicPtr Symbol::getArgres;
 /*****************************************************************************/
 
+/*****************************************************************************/
+// Namenstabelle: Name -> Id, wird nie freigegeben, damit die Zeiger der
+// Symbole auch beim Beenden gueltig bleiben
+static std::unordered_map<std::string,size_t>& symbolNameTable()
+/*****************************************************************************/
+{
+  static std::unordered_map<std::string,size_t> &table = *new std::unordered_map<std::string,size_t>();
+  return table;
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+void Symbol::internName( std::string const& name )
+/*****************************************************************************/
+{
+  std::unordered_map<std::string,size_t> &table = symbolNameTable();
+  std::unordered_map<std::string,size_t>::iterator ii = table.find(name);
+  if (ii == table.end())
+    ii = table.insert(std::make_pair(name,table.size())).first;
+  m_name = &ii->first;
+  m_id = ii->second;
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+size_t Symbol::findId( std::string const& name )
+/*****************************************************************************/
+{
+  std::unordered_map<std::string,size_t> &table = symbolNameTable();
+  std::unordered_map<std::string,size_t>::const_iterator ii = table.find(name);
+  if (ii == table.end())
+    return NO_ID;
+  return ii->second;
+}
+/*****************************************************************************/
+
 /*****************************************************************************/
 Symbol::Symbol( std::string const& name, 
                 Shape const& shape, 
                 Symbol_Kind category):
-Basic(Type_Symbol,shape), m_name(name), m_kind(category)
+Basic(Type_Symbol,shape), m_kind(category)
 /*****************************************************************************/
 {
+  internName(name);
   m_statekind=ALL;
   m_state = static_cast<size_t*>(calloc(m_shape.getNumEl(),sizeof(size_t)));
   m_state[0] = NO_STATE;
@@ -32,16 +69,16 @@ Basic(Type_Symbol,shape), m_name(name), m_kind(category)
         throw InternalError("Symbol " + name + " constructed twice!");
     symbol_names.insert(name);
 #endif
-    calcHash();
 }
 /*****************************************************************************/
 
 
 /*****************************************************************************/
 Symbol::Symbol( std::string const& name,  Symbol_Kind category):
-Basic(Type_Symbol), m_name(name), m_kind(category)
+Basic(Type_Symbol), m_kind(category)
 /*****************************************************************************/
 {
+  internName(name);
   m_statekind=ALL;
   m_state = static_cast<size_t*>(calloc(m_shape.getNumEl(),sizeof(size_t)));
   m_state[0] = NO_STATE;
@@ -50,7 +87,6 @@ Basic(Type_Symbol), m_name(name), m_kind(category)
         throw InternalError("Symbol " + name + " constructed twice!");
     symbol_names.insert(name);
 #endif
-    calcHash();
 }
 /*****************************************************************************/
 
@@ -62,9 +98,9 @@ Symbol::~Symbol()
   if (m_state)
     free (m_state);
 #ifdef _DEBUG
-    if (symbol_names.find(m_name) != symbol_names.end())
+    if (symbol_names.find(*m_name) != symbol_names.end())
     {
-        symbol_names.erase(m_name);
+        symbol_names.erase(*m_name);
     }
 #endif
 }
@@ -76,9 +112,9 @@ std::string Symbol::toString() const
 /*****************************************************************************/
 {
 #ifdef _DEBUG
-    return "Symbol(" + m_name + ")";
+    return "Symbol(" + *m_name + ")";
 #else
-    return m_name;
+    return *m_name;
 #endif
 }
 /*****************************************************************************/
@@ -87,11 +123,11 @@ std::string Symbol::toString() const
 bool Symbol::operator==(  Basic const& rhs ) const
 /*****************************************************************************/
 {
-    // Versuch zu casten
-    const Symbol *symbol = dynamic_cast<const Symbol*>(&rhs);
-    if (symbol == NULL) return false;
+    // Typ pruefen
+    if (rhs.getType() != Type_Symbol) return false;
+    const Symbol *symbol = static_cast<const Symbol*>(&rhs);
 
-    return getName() == symbol->getName();
+    return m_id == symbol->m_id;
 }
 /*****************************************************************************/
 
@@ -189,27 +225,26 @@ void Symbol::setVariable(size_t dim1, size_t dim2)
   }
   BasicPtrVec subparents;
   BasicPtrVec esubparents;
-  for (ArgumentPtrSet::iterator ii = m_parents.begin();ii!=m_parents.end();++ii)
+  for (ArgumentPtr ii = m_firstParent; ii != NULL; ii = ii->getNextParent())
   {
-    if ((*ii)->getParent().get() != NULL)
+    if (ii->getParent().get() != NULL)
     {
-      if ((*ii)->getParent()->getType() == Type_Der)
+      if (ii->getParent()->getType() == Type_Der)
       {
-        subparents.push_back((*ii)->getParent());
+        subparents.push_back(ii->getParent());
       }
-      else if ((*ii)->getParent()->getType() == Type_Element)
+      else if (ii->getParent()->getType() == Type_Element)
       {
-        Element *elem = Util::getAsPtr<Element>((*ii)->getParent());
+        Element *elem = Util::getAsPtr<Element>(ii->getParent());
         if ((elem->getRow() == dim1) && (elem->getCol() == dim2))
         {
-          ArgumentPtrSet& epars = elem->getParents();
-         for (ArgumentPtrSet::const_iterator jj = epars.begin();jj!=epars.end();jj++)
+         for (ArgumentPtr jj = elem->getFirstParent(); jj != NULL; jj = jj->getNextParent())
           {
-            if ((*jj)->getParent().get() != NULL)
+            if (jj->getParent().get() != NULL)
             {
-              if ((*jj)->getParent()->getType() == Type_Der)
+              if (jj->getParent()->getType() == Type_Der)
               {
-                esubparents.push_back((*jj)->getParent());
+                esubparents.push_back(jj->getParent());
               }
             }
           } 
@@ -263,7 +298,12 @@ void Symbol::setVariable(size_t dim1, size_t dim2)
  BasicPtr Symbol::iterateExp(Iterator &v)
 /*****************************************************************************/
 {
-    return BasicPtr(v.process_Arg(BasicPtr(this)));
+    // Symbole sind meist vielfach geteilt
+    Memo::Pass pass(v.memo);
+    BasicPtr done = v.memo.find(this);
+    if (done.get() != NULL)
+        return done;
+    return v.memo.insert(this, v.process_Arg(BasicPtr(this)));
 }
 /*****************************************************************************/
 
@@ -280,26 +320,27 @@ bool Symbol::operator<(Basic  const& rhs) const
         return (getShape() < rhs.getShape());
 
     // Symbol
-    const Symbol &symbol = dynamic_cast<const Symbol &>(rhs);
+    const Symbol &symbol = static_cast<const Symbol &>(rhs);
 
     // hash vergleichen - vorerst wieder rausgenommen, da es nicht sinnvoll ist
 //    if (m_hash != symbol.getHash())
 //        return m_hash < symbol.getHash();
 
-    // Name vergleichen
-    return m_name < symbol.m_name;
+    // gleiche Id, gleicher Name
+    if (m_id == symbol.m_id)
+        return false;
+
+    // Name vergleichen, die Reihenfolge bleibt alphabetisch
+    return *m_name < *symbol.m_name;
 }
 /*****************************************************************************/
 
 /*****************************************************************************/
-void Symbol::calcHash()
+size_t Symbol::calcHash() const
 /*****************************************************************************/
 {
-    // simple hashing algorithm; taken from the Dragon Book
-    size_t hash = 0;
-    for(size_t i = 0; i < m_name.length(); ++i)
-        hash = 65599 * hash + m_name[i];
-    m_hash = hash;
+    // Id ist eindeutig, nur noch mischen
+    return hashMix(m_id + 1);
 }
 /*****************************************************************************/
 
@@ -59,6 +59,15 @@ SymmetricMatrix::~SymmetricMatrix()
                        BasicPtr const& new_exp)
 /*****************************************************************************/
 {
+    Memo::Pass pass(subsMemo());
+    BasicPtr done = subsMemo().find(this);
+    if (done.get() != NULL)
+        return done;
+
+    // old_exp kann hier nicht vorkommen
+    if (!mayContain(old_exp.get()))
+        return BasicPtr(this);
+
     if (*this == *old_exp.get())
         return new_exp;
 
@@ -68,7 +77,15 @@ SymmetricMatrix::~SymmetricMatrix()
     for (size_t i=0; i<getArgsSize(); ++i)
         subs_args.push_back(getArg(i)->subs(old_exp,new_exp));
 
-    return BasicPtr( new SymmetricMatrix(subs_args, m_shape) );
+    return subsMemo().insert(this, BasicPtr( new SymmetricMatrix(subs_args, m_shape) ) );
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+BasicPtr SymmetricMatrix::newWithArgs( BasicPtrVec &args ) const
+/*****************************************************************************/
+{
+    return BasicPtr( new SymmetricMatrix(args, m_shape) );
 }
 /*****************************************************************************/
 
@@ -76,6 +93,11 @@ SymmetricMatrix::~SymmetricMatrix()
  BasicPtr SymmetricMatrix::iterateExp(Symbolics::Basic::Iterator &v)
 /*****************************************************************************/
 {
+    Memo::Pass pass(v.memo);
+    BasicPtr done = v.memo.find(this);
+    if (done.get() != NULL)
+        return done;
+
     // iterate args
     BasicPtrVec iter_args;
     iter_args.reserve(getArgsSize());
@@ -83,7 +105,43 @@ SymmetricMatrix::~SymmetricMatrix()
     {
         iter_args.push_back(getArg(i)->iterateExp(v));
     }
-    return v.process_Arg(BasicPtr(new SymmetricMatrix(iter_args, m_shape)));
+    return v.memo.insert(this, v.process_Arg(BasicPtr(new SymmetricMatrix(iter_args, m_shape))));
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+bool SymmetricMatrix::operator==( Basic const& rhs) const
+/*****************************************************************************/
+{
+    const SymmetricMatrix *mat = dynamic_cast<const SymmetricMatrix*>(&rhs);
+    if ((mat == NULL) || (m_shape != mat->getShape()))
+        return Matrix::operator==(rhs);
+
+    // verschiedener Hash, dann verschieden
+    if (getHash() != mat->getHash()) return false;
+
+    // (m,n) mit n<m ist gleich (n,m), es reicht das obere Dreieck
+    for (size_t i=0; i<getArgsSize(); ++i)
+        if (getArg(i) != mat->getArg(i))
+            return false;
+    return true;
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+bool SymmetricMatrix::operator<(Basic  const& rhs) const
+/*****************************************************************************/
+{
+    const SymmetricMatrix *mat = dynamic_cast<const SymmetricMatrix*>(&rhs);
+    if ((mat == NULL) || (m_shape != mat->getShape()))
+        return Matrix::operator<(rhs);
+
+    // Der erste Unterschied zeilenweise liegt immer im oberen Dreieck,
+    // die Reihenfolge ist also dieselbe wie bei Matrix
+    for (size_t i=0; i<getArgsSize(); ++i)
+        if (getArg(i) != mat->getArg(i))
+            return (getArg(i) < mat->getArg(i));
+    return false;
 }
 /*****************************************************************************/
 
@@ -134,7 +192,7 @@ SymmetricMatrix SymmetricMatrix::operator+( Real const& rhs) const
 SymmetricMatrix& SymmetricMatrix::operator+=( SymmetricMatrix const& rhs)
 /*****************************************************************************/
 {
-    m_simplified = false;
+    setSimplified(false);
     // Neuen Shape berechnen, koennte eine Exception werfen
      Shape newShape( m_shape+rhs.m_shape );
 
@@ -226,7 +284,7 @@ SymmetricMatrix SymmetricMatrix::operator-( Real const& rhs) const
 SymmetricMatrix& SymmetricMatrix::operator-=( SymmetricMatrix const& rhs)
 /*****************************************************************************/
 {
-    m_simplified = false;
+    setSimplified(false);
     // Neuen Shape berechnen, koennte eine Exception werfen
     Shape newShape( m_shape+rhs.m_shape );
 
@@ -359,7 +417,7 @@ SymmetricMatrix& SymmetricMatrix::operator/=( double rhs)
 SymmetricMatrix::Inserter SymmetricMatrix::operator=( BasicPtr &a)
 /*****************************************************************************/
 {
-    m_simplified = false;
+    setSimplified(false);
     // Wert speichern und Inserter zurueckgeben
     return Inserter(*this, a);
 }
@@ -382,7 +440,7 @@ SymmetricMatrix::Inserter SymmetricMatrix::operator=( double a)
 /*****************************************************************************/
 {
     // Wert speichern und Inserter zurueckgeben
-    BasicPtr r(new Real(a));
+    BasicPtr r(Real::New(a));
     return Inserter(*this, r);
 }
 /*****************************************************************************/
@@ -451,7 +509,7 @@ SymmetricMatrix::Inserter& SymmetricMatrix::Inserter::operator,( double a)
 /*****************************************************************************/
 {
     // Wert speichern und uns selbst zurueckgeben
-    BasicPtr r(new Real(a));
+    BasicPtr r(Real::New(a));
     insert(r);
     return *this;
 }
@@ -479,7 +537,7 @@ SymmetricMatrix SymmetricMatrix::operator-() const
  SymmetricMatrix& SymmetricMatrix::operator=(  SymmetricMatrix &mat )
 /*****************************************************************************/
 {
-    m_simplified = false;
+    setSimplified(false);
     // Shape aendern und NICHT mit Nullen fuellen
     changeShape( mat.getShape(), false );        
 
@@ -553,7 +611,7 @@ SymmetricMatrix Symbolics::operator+ (Int const& lhs, SymmetricMatrix  const& rh
     SymmetricMatrix c( rhs );
     // Addition
     // Wert addieren
-    for (size_t i=0; i<rhs.getShape().getNumEl(); ++i)
+    for (size_t i=0; i<rhs.getNumEl(); ++i)
         c.set(i,lhs + c(i));
     // Rueckgabe
     return c;
@@ -567,7 +625,7 @@ SymmetricMatrix Symbolics::operator+ (Real const& lhs, SymmetricMatrix  const& r
     SymmetricMatrix c( rhs );
     // Addition
     // Wert addieren
-    for (size_t i=0; i<rhs.getShape().getNumEl(); ++i)
+    for (size_t i=0; i<rhs.getNumEl(); ++i)
         c.set(i,lhs + c(i));
     // Rueckgabe
     return c;
@@ -598,7 +656,7 @@ SymmetricMatrix Symbolics::operator- (Int const& lhs, SymmetricMatrix  const& rh
     SymmetricMatrix c( rhs );
     // Addition
     // Wert addieren
-    for (size_t i=0; i<rhs.getShape().getNumEl(); ++i)
+    for (size_t i=0; i<rhs.getNumEl(); ++i)
         c.set(i,lhs - c(i));
     // Rueckgabe
     return c;
@@ -612,7 +670,7 @@ SymmetricMatrix Symbolics::operator- (Real const& lhs, SymmetricMatrix  const& r
     SymmetricMatrix c( rhs );
     // Addition
     // Wert addieren
-    for (size_t i=0; i<rhs.getShape().getNumEl(); ++i)
+    for (size_t i=0; i<rhs.getNumEl(); ++i)
         c.set(i,lhs - c(i));
     // Rueckgabe
     return c;
@@ -643,7 +701,7 @@ SymmetricMatrix Symbolics::operator* (Int const& lhs, SymmetricMatrix  const& rh
     SymmetricMatrix c( rhs );
     // Addition
     // Wert addieren
-    for (size_t i=0; i<rhs.getShape().getNumEl(); ++i)
+    for (size_t i=0; i<rhs.getNumEl(); ++i)
         c.set(i,lhs * c(i));
     // Rueckgabe
     return c;
@@ -657,7 +715,7 @@ SymmetricMatrix Symbolics::operator* (Real const& lhs, SymmetricMatrix  const& r
     SymmetricMatrix c( rhs );
     // Addition
     // Wert addieren
-    for (size_t i=0; i<rhs.getShape().getNumEl(); ++i)
+    for (size_t i=0; i<rhs.getNumEl(); ++i)
         c.set(i,lhs * c(i));
     // Rueckgabe
     return c;
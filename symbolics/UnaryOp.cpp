@@ -54,9 +54,12 @@ bool UnaryOp::operator ==( Basic const& rhs) const
     if (getShape() != rhs.getShape())
       return false;
 
-    // Versuchen zu casten
-    const UnaryOp *unary = dynamic_cast<const UnaryOp*>(&rhs);
-    if (unary == NULL) return false;
+    // verschiedener Hash, dann verschieden
+    if (getHash() != rhs.getHash())
+      return false;
+
+    // gleicher Typ, also auch UnaryOp
+    const UnaryOp *unary = static_cast<const UnaryOp*>(&rhs);
 
     // Vergleich
     return (getArg() == (unary->getArg()));
@@ -76,7 +79,7 @@ bool UnaryOp::operator<(Basic const& rhs) const
         return (getShape() < rhs.getShape());
 
     // UnaryOp
-    const UnaryOp &unary = dynamic_cast<const UnaryOp &>(rhs);
+    const UnaryOp &unary = static_cast<const UnaryOp &>(rhs);
     BasicPtr rhsArg(unary.getArg()); 
 
     // Args vergleichen
@@ -90,11 +93,20 @@ bool UnaryOp::operator<(Basic const& rhs) const
                        BasicPtr const& new_exp)
 /*****************************************************************************/
 {
+    Memo::Pass pass(subsMemo());
+    BasicPtr done = subsMemo().find(this);
+    if (done.get() != NULL)
+        return done;
+
+    // old_exp kann hier nicht vorkommen
+    if (!mayContain(old_exp.get()))
+        return BasicPtr(this);
+
     if (*this == *old_exp.get())
         return new_exp;
 
     // subs args
     BasicPtr subs_arg = getArg()->subs(old_exp,new_exp);
-    return Factory::newBasic( getType(), subs_arg, getShape() );
+    return subsMemo().insert(this, Factory::newBasic( getType(), subs_arg, getShape() ) );
 }
 /*****************************************************************************/
@@ -53,17 +53,17 @@ bool Zero::operator==(  Basic const& rhs ) const
         return true;
     case Type_Bool:
         {
-            const Bool &b = dynamic_cast<const Bool&>(rhs);
+            const Bool &b = static_cast<const Bool&>(rhs);
             return false == b.getValue();
         }
     case Type_Int:
         {
-            const Int &i = dynamic_cast<const Int&>(rhs);
+            const Int &i = static_cast<const Int&>(rhs);
             return 0 == i.getValue();
         }
     case Type_Real:
         {
-            const Real &r = dynamic_cast<const Real&>(rhs);
+            const Real &r = static_cast<const Real&>(rhs);
             return 0 == r.getValue();
         }
     case Type_Matrix:
@@ -94,13 +94,44 @@ bool Zero::operator==(  Basic const& rhs ) const
 /*****************************************************************************/
 
 
+/*****************************************************************************/
+// geteilte Knoten des aktuellen Scopes je Shape, die Tabelle selbst wird nie
+// freigegeben (Reihenfolge der statischen Destruktoren)
+static std::map<Shape,BasicPtr>& zeroPool()
+/*****************************************************************************/
+{
+    static std::map<Shape,BasicPtr> &pool = *new std::map<Shape,BasicPtr>();
+    return pool;
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+void Zero::newScope()
+/*****************************************************************************/
+{
+    zeroPool().clear();
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+BasicPtr const& Zero::getPooled(Shape const& s)
+/*****************************************************************************/
+{
+    BasicPtr &p = zeroPool()[s];
+    if (p.get() == NULL)
+        p = BasicPtr(new Zero(s));
+    return p;
+}
+/*****************************************************************************/
+
+
 /*****************************************************************************/
 BasicPtr Zero::getExactZero(Shape const& s)
 /*****************************************************************************/
 {
 	if (s.getNrDimensions() == 0)
         return zero;
-    return BasicPtr(new Zero(s));
+    return getPooled(s);
 }
 /*****************************************************************************/
 
@@ -111,7 +142,7 @@ BasicPtr Zero::getZero(Shape const& s)
 {
     if (s.getNumEl() == 1)
         return zero;
-    return BasicPtr(new Zero(s));
+    return getPooled(s);
 }
 /*****************************************************************************/
 
@@ -8,6 +8,7 @@
 #include "Mul.h"
 
 #include <math.h>
+#include "Factory.h"
 
 using namespace Symbolics;
 
@@ -51,7 +52,7 @@ std::string Abs::toString() const
 BasicPtr Abs::simplify()
 /*****************************************************************************/
 {
-    if (m_simplified)
+    if (is_Simplified())
         return BasicPtr(this);
     // Argument vereinfachen
     simplifyArg();
@@ -86,7 +87,7 @@ BasicPtr Abs::simplify()
             if ( r >= 0 )
                 return getArg();
             else
-                return BasicPtr( new Real(-r) );
+                return Real::New(-r);
         }
     // fuer Powers mit geraden Exponenten, brauchen wir kein Abs
     case Type_Pow:
@@ -106,7 +107,7 @@ BasicPtr Abs::simplify()
             return mat->applyFunctor(f);
         }    
     }
-    m_simplified = true;
+    setSimplified(true);
     return BasicPtr(this);
 }
 /*****************************************************************************/
@@ -146,7 +147,7 @@ BasicPtr Abs::New( BasicPtr const& arg)
             if ( r >= 0 )
                 return arg;
             else
-                return BasicPtr( new Real(-r) );
+                return Real::New(-r);
         }
     // fuer Powers mit geraden Exponenten, brauchen wir kein Abs
     case Type_Pow:
@@ -166,7 +167,7 @@ BasicPtr Abs::New( BasicPtr const& arg)
             return mat->applyFunctor(f);
         }    
     }
-    return BasicPtr(new Abs(arg));
+    return Factory::unique( BasicPtr(new Abs(arg)) );
 }
 /*****************************************************************************/
 
@@ -8,6 +8,7 @@
 #include "Mul.h"
 #include "Matrix.h"
 #include <math.h>
+#include "Factory.h"
 
 using namespace Symbolics;
 
@@ -54,7 +55,7 @@ std::string Acos::toString() const
 BasicPtr Acos::simplify()
 /*****************************************************************************/
 {
-    if (m_simplified)
+    if (is_Simplified())
         return BasicPtr(this);
     // Argument vereinfachen
     simplifyArg();
@@ -101,7 +102,7 @@ BasicPtr Acos::simplify()
             return mat->applyFunctor(f);
         }
     }
-    m_simplified = true;
+    setSimplified(true);
     return BasicPtr(this);
 }
 /*****************************************************************************/
@@ -152,7 +153,7 @@ BasicPtr Acos::New( BasicPtr const& arg)
             return mat->applyFunctor(f);
         }
     }
-    return BasicPtr(new Acos(arg));
+    return Factory::unique( BasicPtr(new Acos(arg)) );
 }
 /*****************************************************************************/
 
@@ -7,9 +7,29 @@
 #include "Mul.h"
 #include "Util.h"
 #include <list>
+#include <unordered_map>
+#include <algorithm>
+#include "Factory.h"
 
 using namespace Symbolics;
 
+/*****************************************************************************/
+namespace
+{
+    // Summand mit Koeffizient, sortiert wie eine BasicPtrMap
+    typedef std::pair<BasicPtr, BasicPtr> Term;
+    struct TermLess
+    {
+        inline bool operator()( Term const& lhs, Term const& rhs ) const { return lhs.first < rhs.first; };
+    };
+    // gleich im Sinne der BasicPtrMap
+    inline bool sameTerm( BasicPtr const& lhs, BasicPtr const& rhs )
+    {
+        return (lhs.get() == rhs.get()) || (!(lhs < rhs) && !(rhs < lhs));
+    }
+};
+/*****************************************************************************/
+
 
 /*****************************************************************************/
 Add::Add( BasicPtr const& arg1, BasicPtr const& arg2 ): NaryOp(Type_Add, arg1, arg2)
@@ -58,7 +78,7 @@ std::string Add::toString() const
 BasicPtr Add::simplify()
 /*****************************************************************************/
 {
-    if (m_simplified)
+    if (is_Simplified())
         return BasicPtr(this);
     // call arg
     simplifyArgs();
@@ -148,8 +168,10 @@ BasicPtr Add::simplify()
         addArg(val);
         return val;
     }
-    // combine equal args
-    BasicPtrMap argmap;
+    // combine equal args, Suche ueber den Hash, sortiert wird erst am Ende
+    std::vector<Term> terms;
+    terms.reserve(other_args.size());
+    std::unordered_multimap<size_t, size_t> termindex;
     for (size_t i=0; i<other_args.size(); ++i)
     {
         BasicPtr v(new Int(1));
@@ -187,20 +209,33 @@ BasicPtr Add::simplify()
                 }
             }
         }
-        BasicPtrMap::iterator iter = argmap.find(other_args[i]);
-        if (iter == argmap.end())
+        size_t hash = other_args[i]->getHash();
+        std::pair<std::unordered_multimap<size_t, size_t>::iterator, std::unordered_multimap<size_t, size_t>::iterator> range = termindex.equal_range(hash);
+        std::unordered_multimap<size_t, size_t>::iterator found = range.second;
+        for (std::unordered_multimap<size_t, size_t>::iterator ii=range.first; ii!=range.second; ++ii)
         {
-            argmap[other_args[i]] = v;
+            if (sameTerm(terms[ii->second].first, other_args[i]))
+            {
+                found = ii;
+                break;
+            }
+        }
+        if (found == range.second)
+        {
+            termindex.insert(std::make_pair(hash, terms.size()));
+            terms.push_back(Term(other_args[i], v));
         }
         else
         {
-            argmap[other_args[i]] = New(argmap[other_args[i]],v);
+            Term &t = terms[found->second];
+            t.second = New(t.second,v);
         }
     }
-    BasicPtrMap::iterator iter;
+    std::sort(terms.begin(), terms.end(), TermLess());
+    std::vector<Term>::iterator iter;
     BasicPtrVec other_args1;
-    other_args1.reserve( argmap.size() );
-    for(iter=argmap.begin();iter!=argmap.end();++iter)
+    other_args1.reserve( terms.size() );
+    for(iter=terms.begin();iter!=terms.end();++iter)
     {
         if (!Util::is_Zero(iter->second))
         {
@@ -350,7 +385,7 @@ BasicPtr Add::simplify()
     {
         return getArg(0);
     }
-    m_simplified = true;
+    setSimplified(true);
     return BasicPtr(this);
 }
 /*****************************************************************************/
@@ -360,9 +395,12 @@ BasicPtr Add::simplify()
 bool Add::operator==(  Basic const& rhs ) const
 /*****************************************************************************/
 {
-    // Versuch zu casten
-    const Add *add = dynamic_cast<const Add*>(& rhs);
-    if (add == NULL) return false;
+    // Typ pruefen
+    if (rhs.getType() != Type_Add) return false;
+    const Add *add = static_cast<const Add*>(&rhs);
+
+    // verschiedener Hash, dann verschieden
+    if (getHash() != add->getHash()) return false;
 
     // Anzahl der Argumente pruefen
     if (getArgsSize() != add->getArgsSize()) return false;
@@ -410,6 +448,18 @@ bool Add::operator==(  Basic const& rhs ) const
 }
 /*****************************************************************************/
 
+/*****************************************************************************/
+size_t Add::calcHash() const
+/*****************************************************************************/
+{
+    // Summe, damit a+b und b+a gleich sind
+    size_t sum = 0;
+    for (size_t i=0; i<getArgsSize(); ++i)
+        sum += hashMix(getArg(i)->getHash());
+    return hashCombine(hashMix(static_cast<size_t>(m_type) + 1), sum);
+}
+/*****************************************************************************/
+
 /*****************************************************************************/
 BasicPtr Add::New( BasicPtr const& lhs, BasicPtr const& rhs )
 /*****************************************************************************/
@@ -436,7 +486,7 @@ BasicPtr Add::New( BasicPtr const& lhs, BasicPtr const& rhs )
         else if (rhs->getType() == Type_Real) 
         {
             const Real *crhs = Util::getAsConstPtr<Real>(rhs);
-            return BasicPtr(new Real(clhs->getValue()+crhs->getValue()));
+            return Real::New(clhs->getValue()+crhs->getValue());
         }
         else if (rhs->getType() == Type_Matrix) 
         {
@@ -450,12 +500,12 @@ BasicPtr Add::New( BasicPtr const& lhs, BasicPtr const& rhs )
         if (rhs->getType() == Type_Int) 
         {
             const Int *crhs = Util::getAsConstPtr<Int>(rhs);
-            return BasicPtr(new Real(clhs->getValue()+crhs->getValue()));
+            return Real::New(clhs->getValue()+crhs->getValue());
         }
         else if (rhs->getType() == Type_Real) 
         {
             const Real *crhs = Util::getAsConstPtr<Real>(rhs);
-            return BasicPtr(new Real(clhs->getValue()+crhs->getValue()));
+            return Real::New(clhs->getValue()+crhs->getValue());
         }
         else if (rhs->getType() == Type_Matrix) 
         {
@@ -517,7 +567,7 @@ BasicPtr Add::New( BasicPtr const& lhs, BasicPtr const& rhs )
         }
         else
             addargs.push_back(rhs);
-        return BasicPtr(new Add(addargs));
+        return Factory::unique( BasicPtr(new Add(addargs)) );
     }
     if (rhs->getType() == Type_Add)
     {
@@ -527,9 +577,9 @@ BasicPtr Add::New( BasicPtr const& lhs, BasicPtr const& rhs )
         size_t argssize = a->getArgsSize();
         for (size_t j=0; j<argssize; ++j)
           addargs.push_back(a->getArg(j));
-        return BasicPtr(new Add(addargs));
+        return Factory::unique( BasicPtr(new Add(addargs)) );
     }
-    return BasicPtr(new Add(lhs,rhs));
+    return Factory::unique( BasicPtr(new Add(lhs,rhs)) );
 }
 /*****************************************************************************/
 
@@ -7,6 +7,7 @@
 #include "Mul.h"
 #include "Neg.h"
 #include <math.h>
+#include "Factory.h"
 
 using namespace Symbolics;
 
@@ -52,7 +53,7 @@ std::string Asin::toString() const
 BasicPtr Asin::simplify()
 /*****************************************************************************/
 {
-    if (m_simplified)
+    if (is_Simplified())
         return BasicPtr(this);
     // Argument vereinfachen
     simplifyArg();
@@ -100,7 +101,7 @@ BasicPtr Asin::simplify()
             return mat->applyFunctor(f);
         }
     }
-    m_simplified = true;
+    setSimplified(true);
     return BasicPtr(this);
 }
 /*****************************************************************************/
@@ -152,7 +153,7 @@ BasicPtr Asin::New( BasicPtr const& arg)
             return mat->applyFunctor(f);
         }
     }
-    return BasicPtr(new Asin(arg));
+    return Factory::unique( BasicPtr(new Asin(arg)) );
 }
 /*****************************************************************************/
 
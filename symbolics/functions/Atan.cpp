@@ -5,6 +5,7 @@
 #include "Util.h"
 #include "Matrix.h"
 #include <math.h>
+#include "Factory.h"
 
 using namespace Symbolics;
 
@@ -50,7 +51,7 @@ std::string Atan::toString() const
 BasicPtr Atan::simplify()
 /*****************************************************************************/
 {
-    if (m_simplified)
+    if (is_Simplified())
         return BasicPtr(this);
     // Argument vereinfachen
     simplifyArg();
@@ -97,7 +98,7 @@ BasicPtr Atan::simplify()
             return mat->applyFunctor(f);
         }
     }
-    m_simplified = true;
+    setSimplified(true);
     return BasicPtr(this);
 }
 /*****************************************************************************/
@@ -148,7 +149,7 @@ BasicPtr Atan::New( BasicPtr const& arg)
             return mat->applyFunctor(f);
         }
     }
-    return BasicPtr(new Atan(arg));
+    return Factory::unique( BasicPtr(new Atan(arg)) );
 }
 /*****************************************************************************/
 
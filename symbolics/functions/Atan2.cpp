@@ -8,6 +8,7 @@
 #include "Mul.h"
 #include "Util.h"
 #include <math.h>
+#include "Factory.h"
 
 using namespace Symbolics;
 
@@ -72,7 +73,7 @@ std::string Atan2::toString() const
 BasicPtr Atan2::simplify()
 /*****************************************************************************/
 {
-    if (m_simplified)
+    if (is_Simplified())
         return BasicPtr(this);
     // Argument vereinfachen
     simplifyArgs();
@@ -152,7 +153,7 @@ BasicPtr Atan2::simplify()
 
         return BasicPtr( new Real(atan2( src1->getValue(), src2->getValue() )) );
     }
-    m_simplified = true;
+    setSimplified(true);
     return BasicPtr(this);
 }
 /*****************************************************************************/
@@ -235,7 +236,7 @@ BasicPtr Atan2::New( BasicPtr const& arg1, BasicPtr const& arg2)
 
         return BasicPtr( new Real(atan2( src1->getValue(), src2->getValue() )) );
     }
-    return BasicPtr(new Atan2(arg1,arg2));
+    return Factory::unique( BasicPtr(new Atan2(arg1,arg2)) );
 }
 /*****************************************************************************/
 
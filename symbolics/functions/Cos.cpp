@@ -7,6 +7,7 @@
 #include "Mul.h"
 #include "Matrix.h"
 #include <math.h>
+#include "Factory.h"
 
 
 using namespace Symbolics;
@@ -52,7 +53,7 @@ std::string Cos::toString() const
 BasicPtr Cos::simplify()
 /*****************************************************************************/
 {
-    if (m_simplified)
+    if (is_Simplified())
         return BasicPtr(this);
     // Argument vereinfachen
     simplifyArg();
@@ -97,7 +98,7 @@ BasicPtr Cos::simplify()
         {
             const Neg *neg = Util::getAsConstPtr<Neg>(getArg());
             setArg(neg->getArg());
-            m_simplified = false;
+            setSimplified(false);
             return simplify();
         }
     case Type_Matrix:
@@ -107,7 +108,7 @@ BasicPtr Cos::simplify()
             return mat->applyFunctor(f);
         }
     }
-    m_simplified = true;
+    setSimplified(true);
     return BasicPtr(this);
 }
 /*****************************************************************************/
@@ -165,7 +166,7 @@ BasicPtr Cos::New( BasicPtr const& arg)
             return negmat;
         }
     }
-    return BasicPtr(new Cos(arg));
+    return Factory::unique( BasicPtr(new Cos(arg)) );
 }
 /*****************************************************************************/
 
@@ -3,6 +3,7 @@
 #include "Symbol.h"
 #include "Int.h"
 #include "Matrix.h"
+#include "Factory.h"
 
 using namespace Symbolics;
 
@@ -46,7 +47,7 @@ std::string Der::toString() const
 BasicPtr Der::simplify()
 /*****************************************************************************/
 {
-    if (m_simplified)
+    if (is_Simplified())
         return BasicPtr(this);
     // Argument vereinfachen
     simplifyArg();
@@ -67,7 +68,7 @@ BasicPtr Der::simplify()
         return mat->applyFunctor(f);
     }
   }
-  m_simplified = true;
+  setSimplified(true);
   return BasicPtr(this);
 }
 /*****************************************************************************/
@@ -86,7 +87,7 @@ BasicPtr Der::New( BasicPtr const& arg)
   case Type_Real:
         return Zero::getZero();
   case Type_Der:
-     return BasicPtr(new Der(arg));
+     return Factory::unique( BasicPtr(new Der(arg)) );
   case Type_Matrix:
     {
         Matrix::UnaryFunctor<Der> f;
@@ -9,6 +9,7 @@
 #include "Add.h"
 #include "Mul.h"
 #include "str.h"
+#include "Factory.h"
 
 using namespace Symbolics;
 
@@ -87,7 +88,7 @@ std::string Element::toString() const
 BasicPtr Element::simplify()
 /*****************************************************************************/
 {
-  if (m_simplified)
+  if (is_Simplified())
     return BasicPtr(this);
 
   // simplify argument
@@ -188,7 +189,7 @@ BasicPtr Element::simplify()
         return New(a,m_row,m_col);
     }
   }
-  m_simplified = true;
+  setSimplified(true);
   return BasicPtr(this);
 }
 /*****************************************************************************/
@@ -299,7 +300,7 @@ BasicPtr Element::New( BasicPtr const& arg, size_t zeroBasedRow, size_t zeroBase
         return New(a,zeroBasedRow,zeroBasedCol);
     }
   }
-  return BasicPtr(new Element(arg,zeroBasedRow,zeroBasedCol));
+  return Factory::unique( BasicPtr(new Element(arg,zeroBasedRow,zeroBasedCol)) );
 }
 /*****************************************************************************/
 
@@ -2,6 +2,7 @@
 #include "If.h"
 #include "Bool.h"
 #include "Util.h"
+#include "Factory.h"
 
 using namespace Symbolics;
 
@@ -60,7 +61,7 @@ std::string If::toString() const
 BasicPtr If::simplify()
 /*****************************************************************************/
 {
-    if (m_simplified)
+    if (is_Simplified())
         return BasicPtr(this);
     // call arg
     simplifyArgs();
@@ -74,7 +75,7 @@ BasicPtr If::simplify()
         else
             return getArg(2);
     }
-    m_simplified = true;
+    setSimplified(true);
     return BasicPtr(this);
 }
 /*****************************************************************************/
@@ -84,9 +85,12 @@ BasicPtr If::simplify()
 bool If::operator==(  Basic const& rhs ) const
 /*****************************************************************************/
 {
-    // Versuch zu casten
-    const If *i = dynamic_cast<const If*>(& rhs);
-    if (i == NULL) return false;
+    // Typ pruefen
+    if (rhs.getType() != Type_If) return false;
+    const If *i = static_cast<const If*>(&rhs);
+
+    // verschiedener Hash, dann verschieden
+    if (getHash() != i->getHash()) return false;
 
     for (size_t l=0;l<3;++l)
         if (getArg(l) != i->getArg(l)) 
@@ -110,6 +114,6 @@ BasicPtr If::New( BasicPtr const& cond, BasicPtr const& arg1, BasicPtr const& ar
         else
             return arg2;
     }
-    return BasicPtr(new If(cond,arg1,arg2));
+    return Factory::unique( BasicPtr(new If(cond,arg1,arg2)) );
 }
 /*****************************************************************************/
@@ -3,6 +3,7 @@
 #include "Util.h"
 #include "Neg.h"
 #include "Operators.h"
+#include "Factory.h"
 
 using namespace Symbolics;
 
@@ -54,7 +55,7 @@ std::string Inverse::toString() const
 BasicPtr Inverse::simplify()
 /*****************************************************************************/
 {
-    if (m_simplified)
+    if (is_Simplified())
         return BasicPtr(this);
     // Argument vereinfachen
     simplifyArg();
@@ -80,7 +81,7 @@ BasicPtr Inverse::simplify()
             return trans->getArg();
         }
     }
-    m_simplified = true;
+    setSimplified(true);
     return BasicPtr(this);
 }
 /*****************************************************************************/
@@ -114,6 +115,6 @@ BasicPtr Inverse::New( BasicPtr const& arg )
             return trans->getArg();
         }
     }
-    return BasicPtr( new Inverse(arg) );
+    return Factory::unique( BasicPtr(new Inverse(arg)) );
 }
 /*****************************************************************************/
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "Matrix.h"
 #include "Der.h"
 #include "Matrix.h"
+#include "Factory.h"
 
 using namespace Symbolics;
 
@@ -63,7 +64,7 @@ std::string Jacobian::toString() const
 BasicPtr Jacobian::simplify()
 /*****************************************************************************/
 {
-  if (m_simplified)
+  if (is_Simplified())
     return BasicPtr(this);
   // Argument vereinfachen
   simplifyArgs();
@@ -90,7 +91,7 @@ BasicPtr Jacobian::simplify()
         mat->set(i,j,getArg1()->getArg(j)->der(getArg2()->getArg(i))->simplify());
     return BasicPtr(mat);
   }
-  m_simplified = true;
+  setSimplified(true);
   return BasicPtr(this);
 }
 /*****************************************************************************/
@@ -135,7 +136,7 @@ BasicPtr Jacobian::New( BasicPtr const& exp, BasicPtr const& symbols)
 
     return BasicPtr(mat);
   }
-  return BasicPtr( new Jacobian(exp1,symbols));
+  return Factory::unique( BasicPtr(new Jacobian(exp1,symbols)) );
 }
 /*****************************************************************************/
 
@@ -1,6 +1,7 @@
 #include "Less.h"
 #include "Bool.h"
 #include "Util.h"
+#include "Factory.h"
 
 using namespace Symbolics;
 
@@ -53,7 +54,7 @@ std::string Less::toString() const
 BasicPtr Less::simplify()
 /*****************************************************************************/
 {
-    if (m_simplified)
+    if (is_Simplified())
         return BasicPtr(this);
     // Argument vereinfachen
     simplifyArgs();
@@ -75,7 +76,7 @@ BasicPtr Less::simplify()
         else if (getArg2()->getType() == Type_Real) 
         {
             const Real *crhs = Util::getAsConstPtr<Real>(getArg2());
-            return BasicPtr(new Real(crhs->getValue()>(clhs->getValue()?1.0:0.0)));
+            return Real::New(crhs->getValue()>(clhs->getValue()?1.0:0.0));
         }
     }
     if (getArg1()->getType() == Type_Int) 
@@ -94,7 +95,7 @@ BasicPtr Less::simplify()
         else if (getArg2()->getType() == Type_Real) 
         {
             const Real *crhs = Util::getAsConstPtr<Real>(getArg2());
-            return BasicPtr(new Real(crhs->getValue()>clhs->getValue()));
+            return Real::New(crhs->getValue()>clhs->getValue());
         }
     }
     if (getArg1()->getType() == Type_Real) 
@@ -113,10 +114,10 @@ BasicPtr Less::simplify()
         else if (getArg2()->getType() == Type_Real) 
         {
             const Real *crhs = Util::getAsConstPtr<Real>(getArg2());
-            return BasicPtr(new Real(crhs->getValue()>clhs->getValue()));
+            return Real::New(crhs->getValue()>clhs->getValue());
         }
     }
-    m_simplified = true;
+    setSimplified(true);
     return BasicPtr(this);
 }
 /*****************************************************************************/
@@ -184,6 +185,6 @@ BasicPtr Less::New( BasicPtr const& arg1, BasicPtr const& arg2)
             return BasicPtr(new Bool(crhs->getValue()>clhs->getValue()));
         }
     }
-    return BasicPtr(new Less(arg1,arg2));
+    return Factory::unique( BasicPtr(new Less(arg1,arg2)) );
 }
 /*****************************************************************************/
\ No newline at end of file
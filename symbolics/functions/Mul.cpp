@@ -6,6 +6,7 @@
 #include "Util.h"
 #include "Pow.h"
 #include <list>
+#include "Factory.h"
 
 using namespace Symbolics;
 
@@ -53,7 +54,7 @@ std::string Mul::toString() const
 BasicPtr Mul::simplify()
 /*****************************************************************************/
 {
-    if (m_simplified)
+    if (is_Simplified())
         return BasicPtr(this);
     // call arg
     simplifyArgs();
@@ -252,7 +253,7 @@ BasicPtr Mul::simplify()
         setArg(0,Neg::New(getArg(0)));
         return Neg::New(BasicPtr(new Mul(args)));
     }
-    m_simplified = true;
+    setSimplified(true);
     return BasicPtr(this);
 }
 /*****************************************************************************/
@@ -261,9 +262,12 @@ BasicPtr Mul::simplify()
 bool Mul::operator==(  Basic const& rhs ) const
 /*****************************************************************************/
 {
-    // Versuch zu casten
-    const Mul *mul = dynamic_cast<const Mul*>(&rhs);
-    if (mul == NULL) return false;
+    // Typ pruefen
+    if (rhs.getType() != Type_Mul) return false;
+    const Mul *mul = static_cast<const Mul*>(&rhs);
+
+    // verschiedener Hash, dann verschieden
+    if (getHash() != mul->getHash()) return false;
 
       // Anzahl der Argumente pruefen
     if (getArgsSize() != mul->getArgsSize()) return false;
@@ -334,6 +338,24 @@ bool Mul::operator==(  Basic const& rhs ) const
 }
 /*****************************************************************************/
 
+/*****************************************************************************/
+size_t Mul::calcHash() const
+/*****************************************************************************/
+{
+    // skalare Argumente als Summe (vertauschbar), die anderen der Reihe nach
+    size_t sum = 0;
+    size_t hash = hashMix(static_cast<size_t>(m_type) + 1);
+    for (size_t i=0; i<getArgsSize(); ++i)
+    {
+        if (getArg(i)->is_Scalar())
+            sum += hashMix(getArg(i)->getHash());
+        else
+            hash = hashCombine(hash, getArg(i)->getHash());
+    }
+    return hashCombine(hash, sum);
+}
+/*****************************************************************************/
+
 /*****************************************************************************/
 BasicPtr Mul::New( BasicPtr const& lhs, BasicPtr  const& rhs )
 /*****************************************************************************/
@@ -364,7 +386,7 @@ BasicPtr Mul::New( BasicPtr const& lhs, BasicPtr  const& rhs )
         else if (rhs->getType() == Type_Real) 
         {
             const Real *crhs = Util::getAsConstPtr<Real>(rhs);
-            return BasicPtr(new Real(clhs->getValue()*crhs->getValue()));
+            return Real::New(clhs->getValue()*crhs->getValue());
         }
         else if (rhs->getType() == Type_Matrix) 
         {
@@ -382,12 +404,12 @@ BasicPtr Mul::New( BasicPtr const& lhs, BasicPtr  const& rhs )
         if (rhs->getType() == Type_Int) 
         {
             const Int *crhs = Util::getAsConstPtr<Int>(rhs);
-            return BasicPtr(new Real(clhs->getValue()*crhs->getValue()));
+            return Real::New(clhs->getValue()*crhs->getValue());
         }
         else if (rhs->getType() == Type_Real) 
         {
             const Real *crhs = Util::getAsConstPtr<Real>(rhs);
-            return BasicPtr(new Real(clhs->getValue()*crhs->getValue()));
+            return Real::New(clhs->getValue()*crhs->getValue());
         }
         else if (rhs->getType() == Type_Matrix) 
         {
@@ -465,7 +487,7 @@ BasicPtr Mul::New( BasicPtr const& lhs, BasicPtr  const& rhs )
         }
         else
             mulargs.push_back(rhs);
-        return BasicPtr(new Mul(mulargs));
+        return Factory::unique( BasicPtr(new Mul(mulargs)) );
     }
     if (rhs->getType() == Type_Mul)
     {
@@ -475,9 +497,9 @@ BasicPtr Mul::New( BasicPtr const& lhs, BasicPtr  const& rhs )
         size_t argssize = a->getArgsSize();
         for (size_t j=0; j<argssize; ++j)
           mulargs.push_back(a->getArg(j));
-        return BasicPtr(new Mul(mulargs));
+        return Factory::unique( BasicPtr(new Mul(mulargs)) );
     }
-    return BasicPtr(new Mul(lhs,rhs));
+    return Factory::unique( BasicPtr(new Mul(lhs,rhs)) );
 }
 /*****************************************************************************/
 
@@ -3,6 +3,7 @@
 #include "Bool.h"
 #include "Matrix.h"
 #include "Util.h"
+#include "Factory.h"
 
 using namespace Symbolics;
 
@@ -47,7 +48,7 @@ std::string Neg::toString() const
 BasicPtr Neg::simplify()
 /*****************************************************************************/
 {
-    if (m_simplified)
+    if (is_Simplified())
         return BasicPtr(this);
     // Argument vereinfachen
     simplifyArg();
@@ -68,7 +69,7 @@ BasicPtr Neg::simplify()
     case Type_Real:
         {
             const Real *c = Util::getAsConstPtr<Real>(getArg());
-            return BasicPtr( new Real(-(c->getValue())) );
+            return Real::New(-(c->getValue()));
         }
     case Type_Bool:
         {
@@ -89,7 +90,7 @@ BasicPtr Neg::simplify()
         }
     }
     // simplify Neg
-    m_simplified = true;
+    setSimplified(true);
     return BasicPtr(this);
 }
 /*****************************************************************************/
@@ -119,7 +120,7 @@ BasicPtr Neg::New(BasicPtr const& e)
     case Type_Real:
         {
             const Real *c = Util::getAsConstPtr<Real>(e);
-            return BasicPtr( new Real(-(*c).getValue()) );
+            return Real::New(-(*c).getValue());
         }
         // -(-(a)) = a
     case Type_Neg:
@@ -129,8 +130,7 @@ BasicPtr Neg::New(BasicPtr const& e)
         }
     case Type_Matrix:
         {
-            BasicSet atoms = e->getAtoms();
-            if (atoms.size() == 0)
+            if (!e->hasAtoms())
             {
                 const Matrix *c = Util::getAsConstPtr<Matrix>(e);
                 return Int::getMinusOne()*(*c);
@@ -138,6 +138,6 @@ BasicPtr Neg::New(BasicPtr const& e)
             break;
         }
     }
-    return BasicPtr(new Neg(e));
+    return Factory::unique( BasicPtr(new Neg(e)) );
 }
 /*****************************************************************************/
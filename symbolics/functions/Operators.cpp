@@ -85,6 +85,9 @@ bool Symbolics::operator>(BasicPtr const& lhs, BasicPtr  const& rhs)
 bool Symbolics::operator== (BasicPtr const& lhs, BasicPtr  const& rhs)
 /*****************************************************************************/
 {
+    // geteilte Knoten (Hash-Consing) sind identisch
+    if (lhs.get() == rhs.get())
+        return true;
     // zuerst den Typ vergleichen
     // Ausnamen fuer Zero
     if (lhs->getType() == Type_Zero)
@@ -124,6 +127,8 @@ bool Symbolics::operator== (BasicPtr const& lhs, BasicPtr  const& rhs)
     if (lhs->getType() != rhs->getType()) return false;
     // Als naechstes den Shape vergleichen
     if (lhs->getShape() != rhs->getShape()) return false;
+    // verschiedener Hash, dann verschieden
+    if (lhs->getHash() != rhs->getHash()) return false;
 
     // Nun als Basic vergleichen
     return (*lhs.get() == *rhs.get());
@@ -135,7 +140,7 @@ bool Symbolics::operator== (double const& lhs, BasicPtr  const& rhs)
 /*****************************************************************************/
 {
     // Nun als Basic vergleichen
-    return BasicPtr(new Real(lhs)) == rhs;
+    return Real::New(lhs) == rhs;
 }
 /*****************************************************************************/
 /*****************************************************************************/
@@ -143,7 +148,7 @@ bool Symbolics::operator== (BasicPtr const& lhs, double  const& rhs)
 /*****************************************************************************/
 {
     // Nun als Basic vergleichen
-    return lhs == BasicPtr(new Real(rhs));
+    return lhs == Real::New(rhs);
 }
 /*****************************************************************************/
 
@@ -180,7 +185,7 @@ bool Symbolics::operator!= (double const& lhs, BasicPtr  const& rhs)
 /*****************************************************************************/
 {
     // Nun als Basic vergleichen
-    return !(BasicPtr(new Real(lhs)) == rhs);
+    return !(Real::New(lhs) == rhs);
 }
 /*****************************************************************************/
 /*****************************************************************************/
@@ -188,7 +193,7 @@ bool Symbolics::operator!= (BasicPtr const& lhs, double  const& rhs)
 /*****************************************************************************/
 {
     // Nun als Basic vergleichen
-    return !(lhs == BasicPtr(new Real(rhs)));
+    return !(lhs == Real::New(rhs));
 }
 /*****************************************************************************/
 
@@ -224,7 +229,7 @@ BasicPtr Symbolics::operator+ (BasicPtr const& lhs, BasicPtr  const& rhs)
 BasicPtr Symbolics::operator+ (double lhs, BasicPtr  const& rhs)
 /*****************************************************************************/
 {
-    BasicPtr l( new Real(lhs) );
+    BasicPtr l( Real::New(lhs) );
     return l + rhs;
 }
 /*****************************************************************************/
@@ -232,7 +237,7 @@ BasicPtr Symbolics::operator+ (double lhs, BasicPtr  const& rhs)
 BasicPtr Symbolics::operator+ (BasicPtr const& lhs, double rhs)
 /*****************************************************************************/
 {
-    BasicPtr r( new Real(rhs) );
+    BasicPtr r( Real::New(rhs) );
     return lhs + r;
 }
 /*****************************************************************************/
@@ -277,7 +282,7 @@ BasicPtr Symbolics::operator- (BasicPtr const& lhs, BasicPtr  const& rhs)
 BasicPtr Symbolics::operator- (double lhs, BasicPtr  const& rhs)
 /*****************************************************************************/
 {
-    BasicPtr l( new Real(lhs) );
+    BasicPtr l( Real::New(lhs) );
     return l - rhs;
 }
 /*****************************************************************************/
@@ -285,7 +290,7 @@ BasicPtr Symbolics::operator- (double lhs, BasicPtr  const& rhs)
 BasicPtr Symbolics::operator- (BasicPtr const& lhs, double rhs)
 /*****************************************************************************/
 {
-    BasicPtr r( new Real(rhs) );
+    BasicPtr r( Real::New(rhs) );
     return lhs - r;
 }
 /*****************************************************************************/
@@ -322,7 +327,7 @@ BasicPtr Symbolics::operator* (BasicPtr const& lhs, BasicPtr  const& rhs)
 BasicPtr Symbolics::operator* (double lhs, BasicPtr  const& rhs)
 /*****************************************************************************/
 {
-    BasicPtr l( new Real(lhs) );
+    BasicPtr l( Real::New(lhs) );
     return l * rhs;
 }
 /*****************************************************************************/
@@ -330,7 +335,7 @@ BasicPtr Symbolics::operator* (double lhs, BasicPtr  const& rhs)
 BasicPtr Symbolics::operator* (BasicPtr const& lhs, double rhs)
 /*****************************************************************************/
 {
-    BasicPtr r( new Real(rhs) );
+    BasicPtr r( Real::New(rhs) );
     return lhs * r;
 }
 /*****************************************************************************/
@@ -4,9 +4,34 @@
 #include "Util.h"
 #include "Mul.h"
 #include "Operators.h"
+#include "Factory.h"
 
 using namespace Symbolics;
 
+/*****************************************************************************/
+// Aeusseres Produkt, fuer zwei Vektoren direkt elementweise ohne die
+// transponierte Kopie und das Matrixprodukt
+static BasicPtr outerMatrix( Matrix const& mat1, Matrix const& mat2 )
+/*****************************************************************************/
+{
+    Shape const& s1 = mat1.getShape();
+    Shape const& s2 = mat2.getShape();
+    // nur Spaltenvektoren, sonst (und bei Laenge 1) ueber das Produkt
+    if ((s1.getNrDimensions() != 1) || (s2.getNrDimensions() != 1) ||
+        (s1.getDimension(2) != 1) || (s2.getDimension(2) != 1) || (s1.getDimension(1) == 1))
+        return BasicPtr( new Matrix( mat1*mat2.transpose() ) );
+
+    size_t rows = s1.getDimension(1);
+    size_t cols = s2.getDimension(1);
+    BasicPtrVec values;
+    values.reserve(rows*cols);
+    for (size_t m=0; m<rows; ++m)
+        for (size_t n=0; n<cols; ++n)
+            values.push_back(mat1(m)*mat2(n));
+    return BasicPtr( new Matrix( values, Shape(rows,cols) ) );
+}
+/*****************************************************************************/
+
 /*****************************************************************************/
 Outer::Outer( BasicPtrVec const& args ): BinaryOp(Type_Outer, args)
 /*****************************************************************************/
@@ -81,7 +106,7 @@ std::string Outer::toString() const
 BasicPtr Outer::simplify()
 /*****************************************************************************/
 {
-    if (m_simplified)
+    if (is_Simplified())
         return BasicPtr(this);
     // Argument vereinfachen
     simplifyArgs();
@@ -95,11 +120,10 @@ BasicPtr Outer::simplify()
 	  {
 		  const Matrix *mat1 = Util::getAsConstPtr<Matrix>(getArg1().get());
 		  const Matrix *mat2 = Util::getAsConstPtr<Matrix>(getArg2().get());
-		  Matrix *mat3 = new Matrix( (*mat1)*mat2->transpose() );
-		  return BasicPtr(mat3);
+		  return outerMatrix(*mat1, *mat2);
 	  }
 	  // do not simplify
-    m_simplified = true;
+    setSimplified(true);
     return BasicPtr(this);
 }
 /*****************************************************************************/
@@ -117,10 +141,9 @@ BasicPtr Outer::New( BasicPtr const& arg1, BasicPtr const& arg2 )
 	{
 		const Matrix *mat1 = Util::getAsConstPtr<Matrix>(arg1.get());
 		const Matrix *mat2 = Util::getAsConstPtr<Matrix>(arg2.get());
-		Matrix *mat3 = new Matrix( (*mat1)*mat2->transpose() );
-		return BasicPtr(mat3);
+		return outerMatrix(*mat1, *mat2);
 	}
 
-    return BasicPtr(new Outer(arg1, arg2));
+    return Factory::unique( BasicPtr(new Outer(arg1, arg2)) );
 }
 /*****************************************************************************/
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include "Pow.h"
 #include "Symbolics.h"
 #include <math.h>
+#include "Factory.h"
 
 using namespace Symbolics;
 
@@ -88,7 +89,7 @@ std::string Pow::toString() const
 BasicPtr Pow::simplify()
 /*****************************************************************************/
 {
-    if (m_simplified)
+    if (is_Simplified())
         return BasicPtr(this);
     // Argument vereinfachen
     simplifyArgs();
@@ -215,7 +216,7 @@ BasicPtr Pow::simplify()
             const Pow *c = Util::getAsConstPtr<Pow>(getArg1());
             setArg2(getArg2()*c->getExponent()->simplify());
             setArg1(c->getBase());
-            m_simplified = true;
+            setSimplified(true);
             return BasicPtr(this);
         }
         // move neg to front in case of round number remove it
@@ -228,7 +229,7 @@ BasicPtr Pow::simplify()
             if ( Util::is_Int(getArg2(), iExp) && (iExp%2==0))
             {
                 setArg1(c->getArg());
-                m_simplified = true;
+                setSimplified(true);
                 return BasicPtr(this);
             }
 
@@ -237,7 +238,7 @@ BasicPtr Pow::simplify()
         }
     }
 
-    m_simplified = true;
+    setSimplified(true);
     return BasicPtr(this);
 }
 /*****************************************************************************/
@@ -378,7 +379,7 @@ BasicPtr Pow::New( BasicPtr const& arg1, BasicPtr const& arg2)
             return Neg::New(New(arg_1,arg2));
         }
     }
-    return BasicPtr(new Pow(arg1,arg2));
+    return Factory::unique( BasicPtr(new Pow(arg1,arg2)) );
 }
 /*****************************************************************************/
 
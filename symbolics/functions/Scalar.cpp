@@ -4,6 +4,7 @@
 #include "Util.h"
 #include "Matrix.h"
 #include "Int.h"
+#include "Factory.h"
 
 using namespace Symbolics;
 
@@ -69,7 +70,7 @@ std::string Scalar::toString() const
 BasicPtr Scalar::simplify()
 /*****************************************************************************/
 {
-    if (m_simplified)
+    if (is_Simplified())
         return BasicPtr(this);
     // Argument vereinfachen
     simplifyArg();
@@ -93,7 +94,7 @@ BasicPtr Scalar::simplify()
     if (getArg()->is_Scalar())
         return getArg();
 
-    m_simplified = true;
+    setSimplified(true);
     return BasicPtr(this);
 }
 /*****************************************************************************/
@@ -116,6 +117,6 @@ BasicPtr Scalar::New(BasicPtr const& arg)
             return Neg::New(New(neg->getArg()));
         }
     }
-    return BasicPtr(new Scalar(arg));
+    return Factory::unique( BasicPtr(new Scalar(arg)) );
 }
 /*****************************************************************************/
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include "Neg.h"
 #include "Util.h"
 #include "Operators.h"
+#include "Factory.h"
 
 using namespace Symbolics;
 
@@ -49,7 +50,7 @@ std::string Sign::toString() const
 BasicPtr Sign::simplify()
 /*****************************************************************************/
 {
-    if (m_simplified)
+    if (is_Simplified())
         return BasicPtr(this);
     // Argument vereinfachen
     simplifyArg();
@@ -93,7 +94,7 @@ BasicPtr Sign::simplify()
             return Neg::New(New(neg->getArg()));
         }
     }
-    m_simplified = true;
+    setSimplified(true);
     return BasicPtr(this);
 }
 /*****************************************************************************/
@@ -141,7 +142,7 @@ BasicPtr Sign::New( BasicPtr const& arg)
             return Neg::New(New(neg->getArg()) );
         }
     }
-    return BasicPtr(new Sign(arg));
+    return Factory::unique( BasicPtr(new Sign(arg)) );
 }
 /*****************************************************************************/
 
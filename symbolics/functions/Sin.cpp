@@ -7,6 +7,7 @@
 #include "Mul.h"
 #include <math.h>
 #include "Matrix.h"
+#include "Factory.h"
 
 using namespace Symbolics;
 
@@ -53,7 +54,7 @@ std::string Sin::toString() const
 BasicPtr Sin::simplify()
 /*****************************************************************************/
 {
-    if (m_simplified)
+    if (is_Simplified())
         return BasicPtr(this);
     // Argument vereinfachen
     simplifyArg();
@@ -98,7 +99,7 @@ BasicPtr Sin::simplify()
             return mat->applyFunctor(f);
         }
     }
-    m_simplified = true;
+    setSimplified(true);
     return BasicPtr(this);
 }
 /*****************************************************************************/
@@ -148,7 +149,7 @@ BasicPtr Sin::New( BasicPtr const& arg)
             return negmat;
         }
     }
-    return BasicPtr(new Sin(arg));
+    return Factory::unique( BasicPtr(new Sin(arg)) );
 }
 /*****************************************************************************/
 
@@ -4,9 +4,25 @@
 #include "Neg.h"
 #include "Util.h"
 #include "Operators.h"
+#include "Factory.h"
 
 using namespace Symbolics;
 
+/*****************************************************************************/
+// Schiefsymmetrische Matrix direkt aus den Elementen anlegen
+static BasicPtr skewMatrix( BasicPtr const& v0, BasicPtr const& v1, BasicPtr const& v2 )
+/*****************************************************************************/
+{
+    BasicPtr const& zero = Zero::getZero();
+    BasicPtrVec values;
+    values.reserve(9);
+    values.push_back(zero); values.push_back(-v2);  values.push_back(v1);
+    values.push_back(v2);   values.push_back(zero); values.push_back(-v0);
+    values.push_back(-v1);  values.push_back(v0);   values.push_back(zero);
+    return BasicPtr( new Matrix( values, Shape(3,3) ) );
+}
+/*****************************************************************************/
+
 /*****************************************************************************/
 Skew::Skew( BasicPtrVec const& args ): UnaryOp(Type_Skew, args)
 /*****************************************************************************/
@@ -66,7 +82,7 @@ std::string Skew::toString() const
 BasicPtr Skew::simplify()
 /*****************************************************************************/
 {
-    if (m_simplified)
+    if (is_Simplified())
         return BasicPtr(this);
     // Argument vereinfachen
     simplifyArg();
@@ -80,12 +96,7 @@ BasicPtr Skew::simplify()
     case Type_Matrix:
         {
             const Matrix *v = Util::getAsConstPtr<Matrix>(getArg());
-            Matrix *m = new Matrix( Shape(3,3) );
-            BasicPtr &Zero = Zero::getZero();
-            *m = Zero, -v->get(2), v->get(1),
-                 v->get(2), Zero, -v->get(0),
-                -v->get(1), v->get(0), Zero;
-            return BasicPtr( m );
+            return skewMatrix(v->get(0), v->get(1), v->get(2));
         }
     case Type_Neg:
         {
@@ -93,7 +104,7 @@ BasicPtr Skew::simplify()
             return Neg::New(New(neg->getArg()));
         }
     }
-    m_simplified = true;
+    setSimplified(true);
     return BasicPtr(this);
 }
 /*****************************************************************************/
@@ -111,12 +122,7 @@ BasicPtr Skew::New( BasicPtr const& arg)
     case Type_Matrix:
         {
             const Matrix *v = Util::getAsConstPtr<Matrix>(arg);
-            Matrix *m = new Matrix( Shape(3,3) );
-            BasicPtr &Zero = Zero::getZero();
-            *m = Zero, -(*v)(2), (*v)(1),
-                 (*v)(2), Zero, -(*v)(0),
-                -(*v)(1), (*v)(0), Zero;
-            return BasicPtr( m );
+            return skewMatrix((*v)(0), (*v)(1), (*v)(2));
         }
     case Type_Neg:
         {
@@ -124,6 +130,6 @@ BasicPtr Skew::New( BasicPtr const& arg)
             return Neg::New(New(neg->getArg()));
         }
     }
-    return BasicPtr(new Skew(arg));
+    return Factory::unique( BasicPtr(new Skew(arg)) );
 }
 /*****************************************************************************/
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include "Neg.h"
 #include "Mul.h"
 #include "Util.h"
+#include "Factory.h"
 
 using namespace Symbolics;
 
@@ -78,7 +79,7 @@ std::string Solve::toString() const
 BasicPtr Solve::simplify()
 /*****************************************************************************/
 {
-    if (m_simplified)
+    if (is_Simplified())
         return BasicPtr(this);
     // Argument vereinfachen
     simplifyArgs();
@@ -98,7 +99,7 @@ BasicPtr Solve::simplify()
     {
         return Util::div(getArg2(),getArg1());
     }
-    m_simplified = true;
+    setSimplified(true);
     return BasicPtr(this);
 }
 /*****************************************************************************/
@@ -122,7 +123,7 @@ BasicPtr Solve::New( BasicPtr const& arg1, BasicPtr const& arg2)
     {
         return Util::div(arg2,arg1);
     }
-    return BasicPtr(new Solve(arg1,arg2));
+    return Factory::unique( BasicPtr(new Solve(arg1,arg2)) );
 }
 /*****************************************************************************/
 
@@ -8,6 +8,7 @@
 #include "Pow.h"
 #include "Mul.h"
 #include <math.h>
+#include "Factory.h"
 
 using namespace Symbolics;
 
@@ -54,7 +55,7 @@ std::string Tan::toString() const
 BasicPtr Tan::simplify()
 /*****************************************************************************/
 {
-    if (m_simplified)
+    if (is_Simplified())
         return BasicPtr(this);
     // Argument vereinfachen
     simplifyArg();
@@ -99,7 +100,7 @@ BasicPtr Tan::simplify()
             return mat->applyFunctor(f);
         }
     }
-    m_simplified = true;
+    setSimplified(true);
     return BasicPtr(this);
 }
 /*****************************************************************************/
@@ -150,7 +151,7 @@ BasicPtr Tan::New( BasicPtr const& arg)
             return mat->applyFunctor(f);
         }
     }
-    return BasicPtr(new Tan(arg));
+    return Factory::unique( BasicPtr(new Tan(arg)) );
 }
 /*****************************************************************************/
 
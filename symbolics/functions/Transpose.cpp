@@ -1,9 +1,11 @@
 #include "Transpose.h"
 #include "Int.h"
 #include "Matrix.h"
+#include "SymmetricMatrix.h"
 #include "Util.h"
 #include "Neg.h"
 #include "Operators.h"
+#include "Factory.h"
 
 using namespace Symbolics;
 
@@ -51,7 +53,7 @@ std::string Transpose::toString() const
 BasicPtr Transpose::simplify()
 /*****************************************************************************/
 {
-    if (m_simplified)
+    if (is_Simplified())
         return BasicPtr(this);
     // Argument vereinfachen
     simplifyArg();
@@ -70,6 +72,9 @@ BasicPtr Transpose::simplify()
         return getArg();
     case Type_Matrix:
         {
+            // symmetrisch, dann bleibt die gepackte Matrix
+            if (SymmetricMatrix::is_Type(getArg().get()))
+                return getArg();
             const Matrix *mat = Util::getAsConstPtr<Matrix>(getArg());
             return BasicPtr(new Matrix(mat->transpose()));
         }
@@ -84,7 +89,7 @@ BasicPtr Transpose::simplify()
             return trans->getArg();
         }
     }
-    m_simplified = true;
+    setSimplified(true);
     return BasicPtr(this);
 }
 /*****************************************************************************/
@@ -109,6 +114,8 @@ BasicPtr Transpose::New( BasicPtr const& arg )
         return arg;
     case Type_Matrix:
         {
+            if (SymmetricMatrix::is_Type(arg.get()))
+                return arg;
             const Matrix *mat = Util::getAsConstPtr<Matrix>(arg);
             return BasicPtr(new Matrix(mat->transpose()));
         }
@@ -125,6 +132,6 @@ BasicPtr Transpose::New( BasicPtr const& arg )
             return trans->getArg();
         }
     }
-    return BasicPtr( new Transpose(arg) );
+    return Factory::unique( BasicPtr(new Transpose(arg)) );
 }
 /*****************************************************************************/
\ No newline at end of file
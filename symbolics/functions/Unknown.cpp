@@ -40,11 +40,11 @@ std::string Unknown::toString() const
 BasicPtr Unknown::simplify()
 /*****************************************************************************/
 {
-    if (m_simplified)
+    if (is_Simplified())
         return BasicPtr(this);
     // simplify args
     simplifyArgs();
-    m_simplified = true;
+    setSimplified(true);
     return BasicPtr(this);
 }
 /*****************************************************************************/
@@ -55,6 +55,15 @@ BasicPtr Unknown::simplify()
                                    BasicPtr const& new_exp)
 /*****************************************************************************/
 {
+    Memo::Pass pass(subsMemo());
+    BasicPtr done = subsMemo().find(this);
+    if (done.get() != NULL)
+        return done;
+
+    // old_exp kann hier nicht vorkommen
+    if (!mayContain(old_exp.get()))
+        return BasicPtr(this);
+
     if (*this == *old_exp.get())
         return new_exp;
 
@@ -64,7 +73,15 @@ BasicPtr Unknown::simplify()
     for (size_t i=0; i<getArgsSize(); ++i)
         subs_args.push_back(getArg(i)->subs(old_exp,new_exp));
 
-    return BasicPtr( new Unknown(m_name, subs_args) );
+    return subsMemo().insert(this, BasicPtr( new Unknown(m_name, subs_args) ) );
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+BasicPtr Unknown::newWithArgs( BasicPtrVec &args ) const
+/*****************************************************************************/
+{
+    return BasicPtr( new Unknown(m_name, args) );
 }
 /*****************************************************************************/
 
@@ -73,6 +90,11 @@ BasicPtr Unknown::simplify()
  BasicPtr Unknown::iterateExp(Iterator &v)
 /*****************************************************************************/
 {
+    Memo::Pass pass(v.memo);
+    BasicPtr done = v.memo.find(this);
+    if (done.get() != NULL)
+        return done;
+
     // iterate args
     BasicPtrVec iter_args;
     iter_args.reserve(getArgsSize());
@@ -80,7 +102,7 @@ BasicPtr Unknown::simplify()
     {
         iter_args.push_back(getArg(i)->iterateExp(v));
     }
-    return v.process_Arg(BasicPtr(new Unknown(m_name, iter_args)));
+    return v.memo.insert(this, v.process_Arg(BasicPtr(new Unknown(m_name, iter_args))));
 }
 /*****************************************************************************/
 
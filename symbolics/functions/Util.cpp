@@ -40,6 +40,7 @@
 #include "Cos.h"
 #include "Sin.h"
 #include "Tan.h"
+#include "Factory.h"
 
 using namespace Symbolics;
 
@@ -118,7 +119,7 @@ BasicPtr Util::div( BasicPtr const& lhs,  BasicPtr const& rhs)
 BasicPtr Util::sqrt( BasicPtr const& arg)
 /*****************************************************************************/
 {
-    BasicPtr sqrt = Pow::New(arg,BasicPtr(new Real(0.5)));
+    BasicPtr sqrt = Pow::New(arg,Real::New(0.5));
     return sqrt->simplify();
 }
 /*****************************************************************************/
@@ -148,7 +149,7 @@ bool Util::is_Zero( BasicPtr const& e)
     case Type_Neg :
     {
         const Basic *b = e.get();
-        const Neg *c = dynamic_cast<const Neg*>(b);
+        const Neg *c = static_cast<const Neg*>(b);
         return is_Zero(c->getArg());
     }
     default:
@@ -188,7 +189,7 @@ bool Util::is_One( BasicPtr const& e)
     case Type_Neg:
     {
         const Basic *b = e.get();
-        const Neg *c = dynamic_cast<const Neg*>(b);
+        const Neg *c = static_cast<const Neg*>(b);
         return is_One(c->getArg());
     }
     default:
@@ -201,8 +202,7 @@ bool Util::is_One( BasicPtr const& e)
 bool Util::is_Const( BasicPtr const& arg)
 /*****************************************************************************/
 {
-    Basic::BasicSet atoms = arg->getAtoms();
-    return atoms.size() == 0;
+    return !arg->hasAtoms();
 }
 /*****************************************************************************/
 
@@ -287,5 +287,12 @@ void Util::newScope()
     Cos::newScope();
     Sin::newScope();
     Tan::newScope();
+    Factory::newScope();
+    // geteilte Konstanten halten sonst die Arena des alten Scopes fest
+    Int::newScope();
+    Real::newScope();
+    Zero::newScope();
+    Eye::newScope();
+    Arena::newScope();
 }
 /*****************************************************************************/
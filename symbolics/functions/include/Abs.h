@@ -9,6 +9,9 @@ namespace Symbolics
     class Abs: public UnaryOp
     {
     public:
+        // Typpruefung fuer Util::getAsConstPtr
+        static inline bool is_Type( Basic const* b ) { return b->getType() == Type_Abs; };
+
         // Konstruktor
         Abs( BasicPtrVec const& args );
         // Konstruktor
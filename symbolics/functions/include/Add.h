@@ -8,6 +8,9 @@ namespace Symbolics
     class Add: public NaryOp
     {
     public:
+        // Typpruefung fuer Util::getAsConstPtr
+        static inline bool is_Type( Basic const* b ) { return b->getType() == Type_Add; };
+
         // Konstruktor
         Add( BasicPtr const& arg1, BasicPtr const& arg2 );
         // Konstruktor
@@ -30,6 +33,10 @@ namespace Symbolics
         // derivative
         BasicPtr der();
         BasicPtr der(BasicPtr const& symbol);
+
+    protected:
+        // hash, unabhaengig von der Reihenfolge der Argumente
+        size_t calcHash() const;
     };
 
     typedef boost::intrusive_ptr< Add> ConstAddPtr;
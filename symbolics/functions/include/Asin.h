@@ -10,6 +10,9 @@ namespace Symbolics
     class Asin: public UnaryOp, public List
     {
     public:
+        // Typpruefung fuer Util::getAsConstPtr
+        static inline bool is_Type( Basic const* b ) { return b->getType() == Type_Asin; };
+
         // Konstruktor
         Asin(  BasicPtrVec const&args );
         // Konstruktor
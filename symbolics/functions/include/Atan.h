@@ -10,6 +10,9 @@ namespace Symbolics
     class Atan: public UnaryOp, public List
     {
     public:
+        // Typpruefung fuer Util::getAsConstPtr
+        static inline bool is_Type( Basic const* b ) { return b->getType() == Type_Atan; };
+
         // Konstruktor
         Atan( BasicPtrVec const& args );
         // Konstruktor
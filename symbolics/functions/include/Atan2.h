@@ -10,6 +10,9 @@ namespace Symbolics
     class Atan2: public BinaryOp, public List
     {
     public:
+        // Typpruefung fuer Util::getAsConstPtr
+        static inline bool is_Type( Basic const* b ) { return b->getType() == Type_Atan2; };
+
         // Konstruktor
         Atan2( BasicPtrVec const& args );
         // Konstruktor
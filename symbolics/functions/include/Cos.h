@@ -10,6 +10,9 @@ namespace Symbolics
     class Cos: public UnaryOp, public List
     {
     public:
+        // Typpruefung fuer Util::getAsConstPtr
+        static inline bool is_Type( Basic const* b ) { return b->getType() == Type_Cos; };
+
         // Konstruktor
         Cos( BasicPtrVec const& args );
         // Konstruktor
@@ -9,6 +9,9 @@ namespace Symbolics
     class Der: public UnaryOp
     {
     public:
+        // Typpruefung fuer Util::getAsConstPtr
+        static inline bool is_Type( Basic const* b ) { return b->getType() == Type_Der; };
+
         // Konstruktor
         Der( BasicPtrVec const& args );
         // Konstruktor
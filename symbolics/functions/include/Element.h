@@ -9,6 +9,9 @@ namespace Symbolics
     class Element: public NaryOp
     {
     public:
+        // Typpruefung fuer Util::getAsConstPtr
+        static inline bool is_Type( Basic const* b ) { return b->getType() == Type_Element; };
+
         // Konstruktor
         Element( BasicPtrVec const& args );
         // Konstruktor
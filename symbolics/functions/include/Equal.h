@@ -8,6 +8,9 @@ namespace Symbolics
     class Equal: public BinaryOp
     {
     public:
+        // Typpruefung fuer Util::getAsConstPtr
+        static inline bool is_Type( Basic const* b ) { return b->getType() == Type_Equal; };
+
         // Konstruktor
         Equal( BasicPtrVec const& args );
         // Konstruktor
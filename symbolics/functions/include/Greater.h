@@ -8,6 +8,9 @@ namespace Symbolics
     class Greater: public BinaryOp
     {
     public:
+        // Typpruefung fuer Util::getAsConstPtr
+        static inline bool is_Type( Basic const* b ) { return b->getType() == Type_Greater; };
+
         // Konstruktor
         Greater( BasicPtrVec const& args );
         // Konstruktor
@@ -8,6 +8,9 @@ namespace Symbolics
     class If: public NaryOp
     {
     public:
+        // Typpruefung fuer Util::getAsConstPtr
+        static inline bool is_Type( Basic const* b ) { return b->getType() == Type_If; };
+
         // Konstruktor
         If( BasicPtr const& cond, BasicPtr const& arg1, BasicPtr const& arg2 );
         // Konstruktor
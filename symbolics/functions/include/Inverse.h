@@ -10,6 +10,9 @@ namespace Symbolics
     class Inverse: public UnaryOp
     {
     public:
+        // Typpruefung fuer Util::getAsConstPtr
+        static inline bool is_Type( Basic const* b ) { return b->getType() == Type_Inverse; };
+
         // Konstruktor
         Inverse( BasicPtrVec const& args );
         // Konstruktor
@@ -9,6 +9,9 @@ namespace Symbolics
     class Jacobian: public BinaryOp
     {
     public:
+        // Typpruefung fuer Util::getAsConstPtr
+        static inline bool is_Type( Basic const* b ) { return b->getType() == Type_Jacobian; };
+
         // Konstruktor
         Jacobian( BasicPtr const& exp, BasicPtr const&  symbols);
         // Konstruktor
@@ -8,6 +8,9 @@ namespace Symbolics
     class Less: public BinaryOp
     {
     public:
+        // Typpruefung fuer Util::getAsConstPtr
+        static inline bool is_Type( Basic const* b ) { return b->getType() == Type_Less; };
+
         // Konstruktor
         Less( BasicPtrVec const& args );
         // Konstruktor
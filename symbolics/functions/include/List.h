@@ -11,7 +11,7 @@ namespace Symbolics
     class List;
 };
 
-namespace boost
+namespace Symbolics
 {
     void intrusive_ptr_add_ref( const Symbolics::Scope *p);
     void intrusive_ptr_release( const Symbolics::Scope *p);
@@ -37,8 +37,8 @@ namespace Symbolics
         // Boost Intrusive Ptr
         unsigned int m_refCount;
         // friend
-        friend void ::boost::intrusive_ptr_add_ref( const Scope* p);
-        friend void ::boost::intrusive_ptr_release( const Scope* p);
+        friend void intrusive_ptr_add_ref( const Scope* p);
+        friend void intrusive_ptr_release( const Scope* p);
     };
 
 /*****************************************************************************/
@@ -52,10 +52,11 @@ namespace Symbolics
         static Ty* getAsPtr( List *l )
         {
             if (l == NULL) throw InternalError("Internal Error: List::getAsPtr!");
-            // Zeiger casten
-            Ty* obj = dynamic_cast<Ty*>(l);
-            if (obj == NULL) throw InternalError("Internal Error: dynamic_cast returned NULL!");
-            return obj;
+            // Zeiger casten, die Liste eines Scopes enthaelt nur Objekte einer Klasse
+#ifdef _DEBUG
+            if (dynamic_cast<Ty*>(l) == NULL) throw InternalError("Internal Error: dynamic_cast returned NULL!");
+#endif
+            return static_cast<Ty*>(l);
         };
     protected:
         List(ScopePtr scope);
@@ -74,7 +75,7 @@ namespace Symbolics
 
 
 /*****************************************************************************/
-namespace boost
+namespace Symbolics
 {
     // increment reference count of object *p
     inline void intrusive_ptr_add_ref( const Symbolics::Scope* p)
@@ -93,7 +94,7 @@ namespace boost
             delete p;
     } 
 
-}; // namespace boost
+}; // namespace Symbolics
 /*****************************************************************************/
 
 #endif // __LIST_H_
@@ -9,6 +9,9 @@ namespace Symbolics
     class Mul: public NaryOp
     {
     public:
+        // Typpruefung fuer Util::getAsConstPtr
+        static inline bool is_Type( Basic const* b ) { return b->getType() == Type_Mul; };
+
         // Konstruktor
         Mul( BasicPtr const& arg1, BasicPtr const& arg2 );
         // Konstruktor
@@ -31,6 +34,10 @@ namespace Symbolics
         // derivative
         BasicPtr der();
         BasicPtr der(BasicPtr const& symbol);
+
+    protected:
+        // hash, unabhaengig von der Reihenfolge der skalaren Argumente
+        size_t calcHash() const;
     };
 
     typedef boost::intrusive_ptr< Mul> ConstMulPtr;
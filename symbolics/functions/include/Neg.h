@@ -9,6 +9,9 @@ namespace Symbolics
     class Neg: public UnaryOp
     {
     public:
+        // Typpruefung fuer Util::getAsConstPtr
+        static inline bool is_Type( Basic const* b ) { return b->getType() == Type_Neg; };
+
         // Konstruktor
         Neg( BasicPtrVec const& args );
         // Konstruktor
@@ -6,6 +6,8 @@
 namespace Symbolics
 {
     // Operatoren mit Basics
+    // (nur const&: Temporaere binden ohne Refcount, ein && wuerde nur das
+    // Hoch- und Runterzaehlen beim Kopieren in den neuen Knoten sparen)
     BasicPtr operator+ (BasicPtr const& lhs, BasicPtr  const& rhs);
     BasicPtr operator- (BasicPtr const& lhs, BasicPtr  const& rhs);
     BasicPtr operator* (BasicPtr const& lhs, BasicPtr  const& rhs);
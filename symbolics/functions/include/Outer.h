@@ -9,6 +9,9 @@ namespace Symbolics
     class Outer: public BinaryOp
     {
     public:
+        // Typpruefung fuer Util::getAsConstPtr
+        static inline bool is_Type( Basic const* b ) { return b->getType() == Type_Outer; };
+
         // Konstruktor
         Outer( BasicPtrVec const& args );
         // Konstruktor
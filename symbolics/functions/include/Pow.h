@@ -9,6 +9,9 @@ namespace Symbolics
     class Pow: public BinaryOp
     {
     public:
+        // Typpruefung fuer Util::getAsConstPtr
+        static inline bool is_Type( Basic const* b ) { return b->getType() == Type_Pow; };
+
         // Konstruktor
         Pow( BasicPtrVec const& args );
         // Konstruktor
@@ -8,6 +8,9 @@ namespace Symbolics
     class Scalar: public UnaryOp
     {
     public:
+        // Typpruefung fuer Util::getAsConstPtr
+        static inline bool is_Type( Basic const* b ) { return b->getType() == Type_Scalar; };
+
         // Konstruktor
         Scalar( BasicPtrVec const& args );
         // Konstruktor
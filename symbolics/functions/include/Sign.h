@@ -9,6 +9,9 @@ namespace Symbolics
     class Sign: public UnaryOp
     {
     public:
+        // Typpruefung fuer Util::getAsConstPtr
+        static inline bool is_Type( Basic const* b ) { return b->getType() == Type_Sign; };
+
         // Konstruktor
         Sign( BasicPtrVec const& args );
         // Konstruktor
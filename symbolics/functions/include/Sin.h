@@ -10,6 +10,9 @@ namespace Symbolics
     class Sin: public UnaryOp, public List
     {
     public:
+        // Typpruefung fuer Util::getAsConstPtr
+        static inline bool is_Type( Basic const* b ) { return b->getType() == Type_Sin; };
+
         // Konstruktor
         Sin( BasicPtrVec const& args );
         // Konstruktor
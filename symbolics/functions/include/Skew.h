@@ -9,6 +9,9 @@ namespace Symbolics
     class Skew: public UnaryOp
     {
     public:
+        // Typpruefung fuer Util::getAsConstPtr
+        static inline bool is_Type( Basic const* b ) { return b->getType() == Type_Skew; };
+
         // Konstruktor
         Skew( BasicPtrVec const& args );
         // Konstruktor
@@ -9,6 +9,9 @@ namespace Symbolics
     class Solve: public BinaryOp
     {
     public:
+        // Typpruefung fuer Util::getAsConstPtr
+        static inline bool is_Type( Basic const* b ) { return b->getType() == Type_Solve; };
+
         // Konstruktor
         Solve( BasicPtrVec const& args );
         // Konstruktor
@@ -10,6 +10,9 @@ namespace Symbolics
     class Tan: public UnaryOp, public List
     {
     public:
+        // Typpruefung fuer Util::getAsConstPtr
+        static inline bool is_Type( Basic const* b ) { return b->getType() == Type_Tan; };
+
         // Konstruktor
         Tan( BasicPtrVec const& args );
         // Konstruktor
@@ -9,6 +9,9 @@ namespace Symbolics
     class Transpose: public UnaryOp
     {
     public:
+        // Typpruefung fuer Util::getAsConstPtr
+        static inline bool is_Type( Basic const* b ) { return b->getType() == Type_Transpose; };
+
         // Konstruktor
         Transpose( BasicPtrVec const& args );
         // Konstruktor
@@ -8,6 +8,9 @@ namespace Symbolics
     class Unknown: public NaryOp
     {
     public:
+        // Typpruefung fuer Util::getAsConstPtr
+        static inline bool is_Type( Basic const* b ) { return b->getType() == Type_Unknown; };
+
         // Konstruktor
         Unknown(  std::string const& name, BasicPtrVec const& args );
         // Destruktor
@@ -34,6 +37,8 @@ namespace Symbolics
         BasicPtr der(BasicPtr const& symbol);
 
     protected:
+        BasicPtr newWithArgs( BasicPtrVec &args ) const;
+
         // Name der Unbekannten Funktion
          std::string m_name;
     };
@@ -22,29 +22,33 @@ namespace Symbolics
 
         static BasicPtr sqrt( BasicPtr const& arg);
 
+        // Casts ueber den Typ des Knotens (is_Type der Klasse) statt RTTI,
+        // dynamic_cast nur noch zur Kontrolle im Debug
         template< typename Ty >
-        static Ty* getAsPtr( const BasicPtr & basic )
+        static Ty* getAsPtr( Basic *b )
         {
-            // Zeiger holen
-            Basic *b = basic.get();
             if (b == NULL) throw InternalError("getAsPtr: get() returned NULL!");
-            // Zeiger casten
-            Ty* obj = dynamic_cast<Ty*>(b);
-            if (obj == NULL) throw InternalError("getAsPtr: dynamic_cast returned NULL!");
-            return obj;
+            if (!Ty::is_Type(b)) throw InternalError("getAsPtr: wrong type!");
+#ifdef _DEBUG
+            if (dynamic_cast<Ty*>(b) == NULL) throw InternalError("getAsPtr: dynamic_cast returned NULL!");
+#endif
+            return static_cast<Ty*>(b);
         }
+        template< typename Ty, typename Tp >
+        static inline Ty* getAsPtr( boost::intrusive_ptr<Tp> const& basic ) { return getAsPtr<Ty>(basic.get()); }
 
         template< typename Ty >
-        static const Ty* getAsConstPtr( ConstBasicPtr const& basic )
+        static const Ty* getAsConstPtr( Basic const* b )
         {
-            // Zeiger holen
-            const Basic *b = basic.get();
             if (b == NULL) throw InternalError("getAsConstPtr: get() returned NULL!");
-            // Zeiger casten
-            const Ty* obj = dynamic_cast<const Ty*>(b);
-            if (obj == NULL) throw InternalError("getAsConstPtr: dynamic_cast returned NULL!");
-            return obj;
+            if (!Ty::is_Type(b)) throw InternalError("getAsConstPtr: wrong type!");
+#ifdef _DEBUG
+            if (dynamic_cast<const Ty*>(b) == NULL) throw InternalError("getAsConstPtr: dynamic_cast returned NULL!");
+#endif
+            return static_cast<const Ty*>(b);
         }
+        template< typename Ty, typename Tp >
+        static inline const Ty* getAsConstPtr( boost::intrusive_ptr<Tp> const& basic ) { return getAsConstPtr<Ty>(basic.get()); }
         
         static bool is_Zero( BasicPtr const& cint);
 
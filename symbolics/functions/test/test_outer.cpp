@@ -39,6 +39,16 @@ int test_outer( int &argc,  char *argv[])
     mat3vec.push_back(c*f);
     BasicPtr mat(new Matrix(mat3vec,Shape(3,3)));
     if (o1s != mat) return -1;
+    if (Outer::New(vec1,vec2) != mat) return -2;
+
+    // Nullen bleiben die geteilte Null
+    BasicPtrVec mat4vec;
+    mat4vec.push_back(a);
+    mat4vec.push_back(Zero::getZero());
+    BasicPtr vec4(new Matrix(mat4vec,Shape(2)));
+    BasicPtr o2 = Outer::New(vec4,vec2);
+    if (o2->getShape() != Shape(2,3)) return -3;
+    if (Util::getAsConstPtr<Matrix>(o2)->get(1,2).get() != Zero::getZero().get()) return -4;
     // ToDo
 
 
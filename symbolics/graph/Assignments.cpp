@@ -9,10 +9,26 @@ Symbolics::Graph::Assignment::Assignment( NodePtr node)
   if (node.get() == NULL) throw InternalError("Node is invalid!");
   category = node->get_Category();
   implizit = node->is_Implicit();
+  tearing = node->getTearing();
+  residuals = node->getNumResiduals();
   for(size_t i=0;i<node->getLhsSize();++i)
     lhs.push_back(node->getLhs(i));
   for(size_t i=0;i<node->getRhsSize();++i)
     rhs.push_back(node->getRhs(i));
+  if (implizit && (residuals == 0))
+  {
+    // implizit ohne Tearing: alle Gleichungen sind Residuen fuer SolveFor
+    SymbolPtrElemMap &solveFor = node->getSolveFor();
+    for (SymbolPtrElemMap::iterator ii=solveFor.begin();ii!=solveFor.end();++ii)
+    {
+      if (ii->second.kind == ALL)
+        tearing.push_back(ii->first);
+      else
+        for (SizeTPairSet::iterator jj=ii->second.elements.begin();jj!=ii->second.elements.end();++jj)
+          tearing.push_back(Element::New(ii->first,jj->first,jj->second));
+    }
+    residuals = lhs.size();
+  }
 }
 /*****************************************************************************/
 
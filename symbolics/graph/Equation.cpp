@@ -9,7 +9,7 @@ using namespace Graph;
 Equation::Equation(SymbolPtrElemMap const& SolveFor,
   BasicPtr const& Lhs, 
   BasicPtr const& Rhs, bool implizit):
-m_implizit(implizit),m_category(0),m_numElem(0),m_refCount(0)
+m_implizit(implizit),m_category(0),m_numElem(0),m_numResiduals(0),m_refCount(0)
 /*****************************************************************************/
 {
   setSolveFor(SolveFor);
@@ -24,7 +24,7 @@ m_implizit(implizit),m_category(0),m_numElem(0),m_refCount(0)
 /*****************************************************************************/
 Equation::Equation(SymbolPtrElemMap const& SolveFor, 
   BasicPtrVec const&  Lhs, BasicPtrVec const& Rhs, bool implizit):
-m_implizit(implizit),m_category(0),m_numElem(0),m_refCount(0)
+m_implizit(implizit),m_category(0),m_numElem(0),m_numResiduals(0),m_refCount(0)
 /*****************************************************************************/
 {
   setSolveFor(SolveFor);
@@ -43,6 +43,18 @@ m_implizit(implizit),m_category(0),m_numElem(0),m_refCount(0)
 }
 /*****************************************************************************/
 
+/*****************************************************************************/
+void Equation::setTearing(BasicPtrVec const& tearing, size_t numResiduals)
+/*****************************************************************************/
+{
+  if (numResiduals > m_lhs.size())
+    throw InternalError("More residuals than expressions in Equation " + toString());
+  m_tearing = tearing;
+  m_numResiduals = numResiduals;
+  m_implizit = (numResiduals > 0);
+}
+/*****************************************************************************/
+
 /*****************************************************************************/
 Equation::~Equation()
 /*****************************************************************************/
@@ -93,11 +105,11 @@ void Equation::findSymbols()
   DerivativeScanner scanner(m_symbols);
   for (size_t i=0;i<m_rhs.size();++i)
   {
-    m_rhs[i].getArg()->scanExp(scanner);
+    m_rhs[i].getArg()->walkExp(scanner);
   }
   for (size_t i=0;i<m_lhs.size();++i)
   {
-    m_lhs[i].getArg()->scanExp(scanner);
+    m_lhs[i].getArg()->walkExp(scanner);
   }
 }
 /*****************************************************************************/
@@ -118,6 +130,21 @@ void Equation::subs(ConstBasicPtr const& old_exp, BasicPtr const& new_exp)
 }
 /*****************************************************************************/
 
+/*****************************************************************************/
+void Equation::subs(BasicPtrMap const& repl)
+/*****************************************************************************/
+{
+  for (size_t i=0;i<m_rhs.size();++i)
+  {
+    m_rhs[i].setArg(m_rhs[i].getArg()->subs(repl));
+  }  
+  for (size_t i=0;i<m_lhs.size();++i)
+  {
+    m_lhs[i].setArg(m_lhs[i].getArg()->subs(repl));
+  }  
+}
+/*****************************************************************************/
+
 /*****************************************************************************/
 void Equation::simplify( )
 /*****************************************************************************/
@@ -135,7 +162,7 @@ void Equation::solve(BasicPtr const& exp)
 {
   SymbolPtrElemMap solveFor;
   SymbolScanner scanner(solveFor,true);
-  exp->scanExp(scanner);
+  exp->walkExp(scanner);
   for (SymbolPtrElemMap::iterator jj=solveFor.begin();jj!=solveFor.end();jj++)
   {
     SymbolPtrElemSizeTMap::iterator ii = m_symbols.find(jj->first);
@@ -155,7 +182,7 @@ void Equation::solve(BasicPtr const& exp)
     if (m_lhs[0].getArg() == exp)
     {
       Basic::LookFor sc(exp);
-      m_rhs[0].getArg()->scanExp(sc);
+      m_rhs[0].getArg()->walkExp(sc);
       if (!sc.found)
       {
         m_implizit = false;
@@ -165,7 +192,7 @@ void Equation::solve(BasicPtr const& exp)
     if (m_rhs[0].getArg() == exp)
     {
       Basic::LookFor sc(exp);
-      m_lhs[0].getArg()->scanExp(sc);
+      m_lhs[0].getArg()->walkExp(sc);
       if (!sc.found)
       {
         m_implizit = false;
@@ -194,7 +221,7 @@ void Equation::solve(BasicPtr const& exp)
           if (m_lhs[0].getArg() == derexp)
           {
             Basic::LookFor sc(derexp);
-            m_rhs[0].getArg()->scanExp(sc);
+            m_rhs[0].getArg()->walkExp(sc);
             if (!sc.found)
             {
               m_implizit = false;
@@ -204,7 +231,7 @@ void Equation::solve(BasicPtr const& exp)
           if (m_rhs[0].getArg() == derexp)
           {
             Basic::LookFor sc(derexp);
-            m_lhs[0].getArg()->scanExp(sc);
+            m_lhs[0].getArg()->walkExp(sc);
             if (!sc.found)
             {
               m_implizit = false;
@@ -245,7 +272,7 @@ void Equation::solve(BasicPtr const& exp)
         if (m_lhs[0].getArg() == derexp)
         {
           Basic::LookFor sc(derexp);
-          m_rhs[0].getArg()->scanExp(sc);
+          m_rhs[0].getArg()->walkExp(sc);
           if (!sc.found)
           {
             m_implizit = false;
@@ -255,7 +282,7 @@ void Equation::solve(BasicPtr const& exp)
         if (m_rhs[0].getArg() == derexp)
         {
           Basic::LookFor sc(derexp);
-          m_lhs[0].getArg()->scanExp(sc);
+          m_lhs[0].getArg()->walkExp(sc);
           if (!sc.found)
           {
             m_implizit = false;
@@ -347,17 +374,16 @@ std::string Equation::toString()
 /*****************************************************************************/
 
 /*****************************************************************************/
-bool Equation::DerivativeScanner::process_Arg(BasicPtr const &p, bool &stop)
+bool Equation::DerivativeScanner::enter(Basic const* p, bool &stop)
 /*****************************************************************************/
 {
   if (p->getType() == Type_Der)
   {
     if (inder)
       throw InternalError("Error: der(der(exp)) is not allowed!");
+    // zurueckgesetzt in leave
     inder = true;
-    p->getArg(0)->scanExp(*this);
-    inder = false;
-    return false;
+    return true;
   }
   /*
    DoTo: bei Element(MatrixSymbol*VectorSymbol) geht das hier schief
@@ -367,25 +393,22 @@ bool Equation::DerivativeScanner::process_Arg(BasicPtr const &p, bool &stop)
   {
     if (inelement)
       throw InternalError("Error: element(element(exp)) is not supported!");
-    const Element *e= Util::getAsConstPtr<Element>(p);
+    const Element *e= static_cast<const Element*>(p);
     dim1 = e->getRow();
     dim2 = e->getCol();
     inelement = true;
-    p->getArg(0)->scanExp(*this);
-    inelement = false;
-    return false;
+    return true;
   }
   else if (p->getType() == Type_Symbol)
   {
     SymbolPtr sp;
+    const Symbol *sconst = static_cast<const Symbol*>(p);
     if (inder)
     {
-      const Symbol *sconst = Util::getAsConstPtr<Symbol>(p);
       sp = const_cast<Symbol*>(sconst)->getDerivative();
     }
     else
     {
-      const Symbol *sconst = Util::getAsConstPtr<Symbol>(p);
       sp = const_cast<Symbol*>(sconst);
     }
     if (sp.get() == NULL)
@@ -429,34 +452,42 @@ bool Equation::DerivativeScanner::process_Arg(BasicPtr const &p, bool &stop)
 
 
 /*****************************************************************************/
-bool Equation::SymbolScanner::process_Arg(BasicPtr const &p, bool &stop)
+void Equation::DerivativeScanner::leave(Basic const* p, bool &stop)
+/*****************************************************************************/
+{
+  if (p->getType() == Type_Der)
+    inder = false;
+  else if (p->getType() == Type_Element)
+    inelement = false;
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+bool Equation::SymbolScanner::enter(Basic const* p, bool &stop)
 /*****************************************************************************/
 {
   if (p->getType() == Type_Der)
   {
     if (inder)
       throw InternalError("Error: der(der(exp)) is not allowed!");
+    // zurueckgesetzt in leave
     inder = true;
-    p->getArg(0)->scanExp(*this);
-    inder = false;
-    return false;
+    return true;
   }
   else if (p->getType() == Type_Element)
   {
     if (inelement)
       throw InternalError("Error: element(element(exp)) is not supported!");
-    const Element *e= Util::getAsConstPtr<Element>(p);
+    const Element *e= static_cast<const Element*>(p);
     dim1 = e->getRow();
     dim2 = e->getCol();
     inelement = true;
-    p->getArg(0)->scanExp(*this);
-    inelement = false;
-    return false;
+    return true;
   }
   else if (p->getType() == Type_Symbol)
   {
     Symbol *s=NULL;
-    const Symbol *sconst = Util::getAsConstPtr<Symbol>(p);
+    const Symbol *sconst = static_cast<const Symbol*>(p);
     if (inder)
     {
       s = const_cast<Symbol*>(sconst)->getDerivative();
@@ -511,6 +542,17 @@ bool Equation::SymbolScanner::process_Arg(BasicPtr const &p, bool &stop)
 /*****************************************************************************/
 
 
+/*****************************************************************************/
+void Equation::SymbolScanner::leave(Basic const* p, bool &stop)
+/*****************************************************************************/
+{
+  if (p->getType() == Type_Der)
+    inder = false;
+  else if (p->getType() == Type_Element)
+    inelement = false;
+}
+/*****************************************************************************/
+
 /*****************************************************************************/
 BasicPtr Equation::DerRepl::process_Arg(BasicPtr const &p)
 /*****************************************************************************/
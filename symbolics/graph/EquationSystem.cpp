@@ -27,12 +27,10 @@ BasicPtr EquationSystem::addSymbol( SymbolPtr const& s , Symbolics::Basic *inita
 {
   // check if already there
   const Symbol *sym = Util::getAsConstPtr<Symbol>(s);
-  std::string name = sym->getName();
-  StringSymbolMap::iterator kk = m_SymbolMap.find(name);
-  if (kk != m_SymbolMap.end())
+  if (findSymbol(sym->getId()) != NULL)
   {
     // fehler werfen
-    throw SymbolAlreadyExistsError(name);
+    throw SymbolAlreadyExistsError(sym->getName());
   }
   return addSymbol_Internal(s, initalValue, comment);
 }
@@ -43,11 +41,14 @@ BasicPtr EquationSystem::addSymbol_Internal( SymbolPtr const& s,
   Symbolics::Basic *initalValue, std::string comment)
 /*****************************************************************************/
 {
-  StringSymbolMap::iterator ii = m_SymbolMap.find(s->getName());
-  if (ii != m_SymbolMap.end())
-    return ii->second;
+  Symbol *found = findSymbol(s->getId());
+  if (found != NULL)
+    return BasicPtr(found);
   // add
   m_SymbolMap[s->getName()] = s;
+  if (m_SymbolById.size() <= s->getId())
+    m_SymbolById.resize(s->getId()+1,NULL);
+  m_SymbolById[s->getId()] = s.get();
 
   if (initalValue == NULL)
   {
@@ -59,7 +60,7 @@ BasicPtr EquationSystem::addSymbol_Internal( SymbolPtr const& s,
       throw ShapeError("Could not use Initvalue " + initalValue->toString() + " for Symbol " + s->toString() + "!");
     BasicPtr init = BasicPtr(initalValue->simplify());
     InitValueScanner sc;
-    init->scanExp(sc);
+    init->walkExp(sc);
     if (sc.variable)
       throw InitalValueError("Initvalue is not constant: " + init->toString() + "!");
     m_symbolsvaluemap[s] = init;
@@ -144,7 +145,7 @@ void EquationSystem::addEquation(BasicPtr const& solveFor,
   getSymbolOrDer(symbols,solveFor);
   // get all other derivatives
   DerivativeScanner scanner;
-  simpleexp->scanExp(scanner);
+  simpleexp->walkExp(scanner);
 
     // check shape
   if (!implicit)
@@ -353,8 +354,7 @@ void EquationSystem::checkEquation(DerivativeScanner *scanner,
   // symbol nicht angelegt dann Fehler
   for (SymbolPtrElemMap::iterator ii = atoms.begin();ii!=atoms.end();++ii)
   {
-    StringSymbolMap::iterator is = m_SymbolMap.find(ii->first->getName());
-    if (is == m_SymbolMap.end())
+    if (findSymbol(ii->first->getId()) == NULL)
       throw VarUnknownError(ii->first->getName());
   }
   // balanced ?
@@ -399,7 +399,7 @@ void EquationSystem::addEquation( BasicPtrVec const& solveFor,
   for(size_t j=0;j<exp.size();++j)
   {
     simpleexp.push_back(exp[j]->simplify());
-    simpleexp[j]->scanExp(scanner);
+    simpleexp[j]->walkExp(scanner);
   }
   // Symbols of eqn
   checkEquation(&scanner,BasicPtr(),exp,implicit,symbols);
@@ -425,8 +425,7 @@ void EquationSystem::addEquation( EquationPtr eqn)
   SymbolPtrElemSizeTMap &symbols = eqn->getSymbols();
   for (SymbolPtrElemSizeTMap::iterator m=symbols.begin();m!=symbols.end();m++)
   {
-    StringSymbolMap::iterator ii = m_SymbolMap.find(m->first->getName());
-    if (ii==m_SymbolMap.end())
+    if (findSymbol(m->first->getId()) == NULL)
       throw  VarUnknownError(m->first->getName());
   }
   SymbolPtrElemMap& solveFor = eqn->getSolveFor();
@@ -505,6 +504,52 @@ void EquationSystem::eraseEquation( EquationPtr eqn)
 /*****************************************************************************/
 
 
+/*****************************************************************************/
+void EquationSystem::addTornEquation( BasicPtrVec const& lhs,
+  BasicPtrVec const& rhs, BasicPtrVec const& tearing, size_t numResiduals)
+/*****************************************************************************/
+{
+  if (lhs.size() != rhs.size())
+    throw InternalError("Symbolics::  addTornEquation: size of lhs (" + str(lhs.size()) + ") and rhs (" + str(rhs.size()) + ") not equal!");
+  if (tearing.size() != numResiduals)
+    throw InternalError("Symbolics::  addTornEquation: " + str(numResiduals) + " residuals for " + str(tearing.size()) + " tearing variables!");
+  // geloest werden die Zuweisungen und die Tearing Variablen
+  SymbolPtrElemMap symbols;
+  for(size_t j=0;j<lhs.size()-numResiduals;++j)
+    getSymbolOrDer(symbols, lhs[j]);
+  for(size_t j=0;j<tearing.size();++j)
+    getSymbolOrDer(symbols, tearing[j]);
+
+  DerivativeScanner scanner;
+  for(size_t j=0;j<rhs.size();++j)
+    rhs[j]->simplify()->walkExp(scanner);
+  checkEquation(&scanner,BasicPtr(),rhs,true,symbols);
+
+  EquationPtr eqn = new Equation(symbols,lhs,rhs,true);
+  eqn->setTearing(tearing,numResiduals);
+  assignEqnstoSymbols(symbols,eqn);
+  m_equations.insert(eqn);
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+// skalare Eintraege eines Ausdrucks anhaengen
+static void addScalars(BasicPtrVec &vec, BasicPtr const& exp)
+/*****************************************************************************/
+{
+  if (exp->is_Scalar())
+  {
+    vec.push_back(exp);
+    return;
+  }
+  size_t dim1 = exp->getShape().getDimension(1);
+  size_t dim2 = exp->getShape().getDimension(2);
+  for(size_t i=0;i<dim1;++i)
+    for(size_t j=0;j<dim2;++j)
+      vec.push_back(Element::New(exp,i,j));
+}
+/*****************************************************************************/
+
 /*****************************************************************************/
 EquationSystemPtr EquationSystem::makeScalar()
 /*****************************************************************************/
@@ -543,12 +588,15 @@ EquationSystemPtr EquationSystem::makeScalar()
     ToDo:
       alle Gleichungen durchlaufen und Funktionen solve(Das stirbt sowieso), inverse, unknown ersetzen mit neuer Variable
   */
-  SymbolRepl repl(symbolreplacemap);
   // dann equations
   for (EquationPtrSet::iterator e=m_equations.begin();e!=m_equations.end();e++)
   {
-    if ((*e)->is_Implicit())
+    if ((*e)->getNumResiduals() > 0)
     {
+      // zerlegter Block (Tearing): bleibt eine Gleichung, damit die
+      // Zuweisungen nicht vom Residuum getrennt sortiert werden
+      size_t firstResidual = (*e)->getRhsSize() - (*e)->getNumResiduals();
+      size_t numResiduals = 0;
       BasicPtrVec lhsscalar;
       BasicPtrVec rhsscalar;
       for (size_t l=0;l<(*e)->getRhsSize();l++)
@@ -556,35 +604,42 @@ EquationSystemPtr EquationSystem::makeScalar()
         BasicPtr lhs = (*e)->getLhs(l);
         BasicPtr rhs = (*e)->getRhs(l);
 
-        if (lhs == rhs)
+        if ((l < firstResidual) && (lhs == rhs))
           continue;
 
-        lhs = lhs->iterateExp(repl);
-        lhs = lhs->simplify();
-        rhs = rhs->iterateExp(repl);
-        rhs = rhs->simplify();
-
-        if ((lhs->getType() != Type_Matrix) || ((rhs->getType() != Type_Matrix) &&  (rhs->getType() != Type_Zero) &&  (rhs->getType() != Type_Eye)))
-        {
-          lhsscalar.push_back(lhs);
-          rhsscalar.push_back(rhs);
-        }
+        size_t n = lhsscalar.size();
+        addScalars(lhsscalar,lhs->subs(symbolreplacemap)->simplify());
+        addScalars(rhsscalar,rhs->subs(symbolreplacemap)->simplify());
+        if (l >= firstResidual)
+          numResiduals += lhsscalar.size() - n;
+      }
+      BasicPtrVec tearing;
+      for (size_t t=0;t<(*e)->getTearing().size();t++)
+        addScalars(tearing,(*e)->getTearing()[t]->subs(symbolreplacemap)->simplify());
+      eqsys->addTornEquation(lhsscalar,rhsscalar,tearing,numResiduals);
+    }
+    else if ((*e)->is_Implicit())
+    {
+      // Residuen lhs - rhs = 0 skalar fuer die Unbekannten
+      BasicPtrVec unknowns;
+      SymbolPtrElemMap &solveFor = (*e)->getSolveFor();
+      for (SymbolPtrElemMap::iterator ii=solveFor.begin();ii!=solveFor.end();ii++)
+      {
+        if (ii->second.kind == ALL)
+          addScalars(unknowns,BasicPtr(ii->first)->subs(symbolreplacemap)->simplify());
         else
-        {
-          size_t dim1 = rhs->getShape().getDimension(1);
-          size_t dim2 = rhs->getShape().getDimension(2);
-          for(size_t i=0;i<dim1;++i)
-          {
-            for(size_t j=0;j<dim2;++j)
-            {
-              lhsscalar.push_back(Element::New(lhs,i,j));
-              rhsscalar.push_back(Element::New(rhs,i,j));
-            }
-          }
-        }
+          for (SizeTPairSet::iterator jj=ii->second.elements.begin();jj!=ii->second.elements.end();jj++)
+            unknowns.push_back(Element::New(ii->first,jj->first,jj->second));
+      }
+      BasicPtrVec residuals;
+      for (size_t l=0;l<(*e)->getRhsSize();l++)
+      {
+        BasicPtr res = (*e)->getLhs(l) - (*e)->getRhs(l);
+        addScalars(residuals,res->subs(symbolreplacemap)->simplify());
       }
-      if (lhsscalar.size() > 0)
-        eqsys->addEquation(lhsscalar,rhsscalar,(*e)->is_Implicit());
+      if (unknowns.size() != residuals.size())
+        throw InternalError("Implicit equation " + (*e)->toString() + " has " + str(residuals.size()) + " residuals for " + str(unknowns.size()) + " unknowns");
+      eqsys->addEquation(unknowns,residuals,true);
     }
     else
     {
@@ -598,9 +653,9 @@ EquationSystemPtr EquationSystem::makeScalar()
 
         std::string s1 = lhs->toString() + " = " + rhs->toString();
 
-        lhs = lhs->iterateExp(repl);
+        lhs = lhs->subs(symbolreplacemap);
         lhs = lhs->simplify();
-        rhs = rhs->iterateExp(repl);
+        rhs = rhs->subs(symbolreplacemap);
         rhs = rhs->simplify();
 
          std::string s2 = lhs->toString() + " = " + rhs->toString();
@@ -639,33 +694,16 @@ EquationSystemPtr EquationSystem::makeScalar()
   }
   return eqsys;
 }
-/*****************************************************************************/
-
-/*****************************************************************************/
-BasicPtr EquationSystem::SymbolRepl::process_Arg(BasicPtr const &p)
-/*****************************************************************************/
-{
-  if (p->getType() == Type_Symbol)
-  {
-    if (p->is_Scalar())
-      return p;
-    BasicPtrMap::iterator ii = m_symbolmap.find(p);
-    if (ii != m_symbolmap.end())
-      return ii->second;
-  }
-  return p;
-}
-/*****************************************************************************/
 
 /*****************************************************************************/
 SymbolPtr EquationSystem::getSymbol( std::string const& name)
 /*****************************************************************************/
 {
-  // Symbol suchen
-  StringSymbolMap::iterator ii = m_SymbolMap.find(name);
+  // Symbol ueber die Id suchen
+  Symbol *s = findSymbol(Symbol::findId(name));
   // Auf Fehler pruefen
-  if (ii == m_SymbolMap.end()) throw VarUnknownError(name);
-  return ii->second;
+  if (s == NULL) throw VarUnknownError(name);
+  return SymbolPtr(s);
 }
 /*****************************************************************************/
 
@@ -1119,12 +1157,12 @@ void EquationSystem::dumpSystem(std::string file)
 /*****************************************************************************/
 
 /*****************************************************************************/
-bool EquationSystem::InitValueScanner::process_Arg(BasicPtr const &p, bool &stop)
+bool EquationSystem::InitValueScanner::enter(Basic const* p, bool &stop)
 /*****************************************************************************/
 {
   if (p->getType() == Type_Symbol)
   {
-    const Symbol *sconst = Util::getAsConstPtr<Symbol>(p);
+    const Symbol *sconst = static_cast<const Symbol*>(p);
     static Symbol_Kind cat = CONSTANT|PARAMETER;
     if (!(sconst->getKind() & cat))
     {
@@ -1137,31 +1175,28 @@ bool EquationSystem::InitValueScanner::process_Arg(BasicPtr const &p, bool &stop
 /*****************************************************************************/
 
 /*****************************************************************************/
-bool EquationSystem::DerivativeScanner::process_Arg(BasicPtr const &p, bool &stop)
+bool EquationSystem::DerivativeScanner::enter(Basic const* p, bool &stop)
 /*****************************************************************************/
 {
   if (p->getType() == Type_Der)
   {
     if (inder)
       throw InternalError("Error: der(der(exp)) is not allowed!");
+    // zurueckgesetzt in leave
     inder = true;
-    p->getArg(0)->scanExp(*this);
-    inder = false;
-    return false;
+    return true;
   }
   else if (p->getType() == Type_Element)
   {
-    const Element *econst = Util::getAsConstPtr<Element>(p);
+    const Element *econst = static_cast<const Element*>(p);
     inelement = true;
     dim1 = econst->getRow();
     dim2 = econst->getCol();
-    p->getArg(0)->scanExp(*this);
-    inelement = false;
-    return false;
+    return true;
   }
   else if (p->getType() == Type_Symbol)
   {
-    const Symbol *sconst = Util::getAsConstPtr<Symbol>(p);
+    const Symbol *sconst = static_cast<const Symbol*>(p);
     SymbolPtr sp(const_cast<Symbol*>(sconst));
     addAtom(sp);
     if (inder)
@@ -1175,10 +1210,21 @@ bool EquationSystem::DerivativeScanner::process_Arg(BasicPtr const &p, bool &sto
 /*****************************************************************************/
 
 /*****************************************************************************/
-void EquationSystem::DerivativeScanner::process_derArg(BasicPtr const &p)
+void EquationSystem::DerivativeScanner::leave(Basic const* p, bool &stop)
+/*****************************************************************************/
+{
+  if (p->getType() == Type_Der)
+    inder = false;
+  else if (p->getType() == Type_Element)
+    inelement = false;
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+void EquationSystem::DerivativeScanner::process_derArg(Basic const* p)
 /*****************************************************************************/
 {
-  const Symbol *sconst = Util::getAsConstPtr<Symbol>(p);
+  const Symbol *sconst = static_cast<const Symbol*>(p);
   Symbol *s = const_cast<Symbol*>(sconst);
   if (inelement)
   {
@@ -15,6 +15,7 @@ Symbolics::Graph::Graph::Graph()
 {
   // open new Scope
   Util::newScope();
+  m_arena = Arena::getScope();
   // add symbol time
   SymbolPtr t = new Symbol("time");
   eqsys = new EquationSystem();
@@ -93,23 +94,19 @@ Symbolics::Graph::AssignmentsPtr Symbolics::Graph::Graph::getAssignments(Categor
   // get required nodes
   NodeVec reqnodes;
   NodeCollector v(exclude,reqnodes);
+  NodeGraph graph(m_nodes);
   for (size_t i=0;i<m_nodes.size();++i)
   {
-    if (m_nodes[i]->visited == false)
+    if (!graph.is_Visited(i))
     {
       Category_Type c = m_nodes[i]->get_Category();
       if( ( c & inc ) && ( !( c & exclude) ) )
       {
         // get other nodes
-        Node::node_iterate_depth_first(m_nodes[i],v);
+        graph.iterate_depth_first(i,v);
       }
     }
   }
-  // reset visited
-  for (size_t i=0;i<m_nodes.size();++i)
-  {
-    m_nodes[i]->visited = false;
-  }
 
   // build equations
   return AssignmentsPtr(new Assignments(reqnodes));
@@ -163,15 +163,11 @@ void MatchedSystem::sortEquations()
 /*****************************************************************************/
 {
   NodeSorter v;
+  NodeGraph graph(m_nodes);
 
-  for (NodeVec::iterator ii =m_nodes.begin(); ii != m_nodes.end();++ii)
-  {
-    Node::node_iterate_depth_first((*ii),v);
-  }
-  // reset visited
-  for (NodeVec::iterator ii =m_nodes.begin(); ii != m_nodes.end();++ii)
+  for (size_t i=0;i<m_nodes.size();++i)
   {
-    (*ii)->visited = false;
+    graph.iterate_depth_first(i,v);
   }
   m_nodes = v.getNodes();
 }
@@ -7,7 +7,7 @@ using namespace Graph;
 
 /*****************************************************************************/
 Node::Node(EquationPtr eqn,SymbolPtr time):
-m_time(time),m_eqn(eqn),visited(false),m_refCount(0),m_subsed(false)
+id(0),m_subsed(false),m_time(time),m_eqn(eqn),m_refCount(0)
 /*****************************************************************************/
 {
   setSolveFor(m_eqn->getSolveFor());
@@ -287,17 +287,64 @@ void Node::subs(ConstBasicPtr const& old_exp, BasicPtr const& new_exp)
 /*****************************************************************************/
 
 /*****************************************************************************/
-void Node::node_iterate_depth_first(NodePtr p, Visitor &v)
+void Node::subs(BasicPtrMap const& repl)
 /*****************************************************************************/
 {
-  if (p->visited)
+  m_subsed = true;
+  m_eqn->subs(repl);
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+NodeGraph::NodeGraph(NodeVec const& nodes):
+m_nodes(nodes),m_parentStart(nodes.size()+1,0),m_visited(nodes.size(),0)
+/*****************************************************************************/
+{
+  for (size_t i=0;i<m_nodes.size();++i)
+  {
+    m_nodes[i]->id = i;
+    m_parentStart[i+1] = m_parentStart[i] + m_nodes[i]->getParents().size();
+  }
+  m_parents.reserve(m_parentStart.back());
+  for (size_t i=0;i<m_nodes.size();++i)
+  {
+    NodePtrSet &parents = m_nodes[i]->getParents();
+    for (NodePtrSet::const_iterator ii=parents.begin();ii!=parents.end();++ii)
+    {
+      size_t p = (*ii)->id;
+      if ((p >= m_nodes.size()) || (m_nodes[p] != *ii))
+        throw InternalError("Parent of " + m_nodes[i]->toString() + " is not in the graph!");
+      m_parents.push_back(p);
+    }
+  }
+  m_stack.reserve(m_nodes.size());
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+void NodeGraph::iterate_depth_first(size_t root, Node::Visitor &v)
+/*****************************************************************************/
+{
+  if (m_visited[root])
     return;
-  p->visited = true;
-  NodePtrSet parents = p->getParents();
-  for (NodePtrSet::const_iterator ii =parents.begin(); ii != parents.end() ;++ii)
+  m_visited[root] = 1;
+  m_stack.push_back(SizeTPair(root,m_parentStart[root]));
+  while (!m_stack.empty())
   {
-    node_iterate_depth_first((*ii),v);
+    SizeTPair &top = m_stack.back();
+    if (top.second < m_parentStart[top.first+1])
+    {
+      size_t p = m_parents[top.second++];
+      if (!m_visited[p])
+      {
+        m_visited[p] = 1;
+        m_stack.push_back(SizeTPair(p,m_parentStart[p]));
+      }
+      continue;
+    }
+    size_t n = top.first;
+    m_stack.pop_back();
+    v.process_Node(m_nodes[n]);
   }
-  v.process_Node(p);
 }
 /*****************************************************************************/
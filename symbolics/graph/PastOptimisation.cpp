@@ -27,15 +27,13 @@ void PastOptimisation::optimize()
 /*****************************************************************************/
 {
   NodeOptimizer v(m_time);
+  // Kanten, die beim Ersetzen entfernt oder hinzugefuegt werden, betreffen
+  // nur schon besuchte Knoten, daher reicht die Momentaufnahme
+  NodeGraph graph(m_nodes);
 
   for (size_t i=0;i<m_nodes.size();++i)
   {
-    Node::node_iterate_depth_first(m_nodes[i],v);
-  }
-  // reset visited
-  for (size_t i=0;i<m_nodes.size();++i)
-  {
-    m_nodes[i]->visited = false;
+    graph.iterate_depth_first(i,v);
   }
   // remove subsed nodes
   for (size_t i=0;i<v.removed_nodes.size();++i)
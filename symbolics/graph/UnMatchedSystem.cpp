@@ -2,13 +2,16 @@
 #include "str.h"
 #include <iostream>
 #include <fstream>
+#include <algorithm>
+#include <queue>
+#include <functional>
 
 using namespace Symbolics;
 using namespace Graph;
 
 /*****************************************************************************/
 UnMatchedSystem::UnMatchedSystem(EquationSystemPtr eqsys, NodeVec& nodes):
-SystemHandler(eqsys,nodes)
+SystemHandler(eqsys,nodes), m_rowsValid(false), m_markStamp(0), m_symbolCount(0), m_maxBlockSize(0)
 /*****************************************************************************/
 {
   m_time = m_eqsys->getSymbol("time");
@@ -21,7 +24,6 @@ SystemHandler(eqsys,nodes)
     addSymbolToIncidenceMatrix(ii->second);
   }
   SymbolPtrSet symbolset;
-  SymbolRepl repl(symbolreplacemap);
   const EquationPtrSet &eqns = m_eqsys->getEquations();
   for (EquationPtrSet::const_iterator i = eqns.begin();i != eqns.end(); i++)
   {
@@ -45,8 +47,8 @@ SystemHandler(eqsys,nodes)
       MEquationPtrVec meqns;
       for (size_t m=0;m<e->getLhsSize();m++)
       {
-        BasicPtr lhs = e->getLhs(m)->iterateExp(repl);
-        BasicPtr rhs = e->getRhs(m)->iterateExp(repl);
+        BasicPtr lhs = e->getLhs(m)->subs(symbolreplacemap);
+        BasicPtr rhs = e->getRhs(m)->subs(symbolreplacemap);
         if (rhs->getType() == Type_Solve)
         {
           lhs = Mul::New(rhs->getArg(0),lhs);
@@ -58,8 +60,8 @@ SystemHandler(eqsys,nodes)
           eq->lhs = lhs->simplify();
           eq->rhs = rhs->simplify();
           SymbolScanner scan(eq,m_time,m_incidencematrixT);
-          eq->lhs->scanExp(scan);
-          eq->rhs->scanExp(scan);
+          eq->lhs->walkExp(scan);
+          eq->rhs->walkExp(scan);
           m_equations.push_back(eq);
           meqns.push_back(eq);
         }
@@ -74,8 +76,8 @@ SystemHandler(eqsys,nodes)
               eq->lhs = Element::New(lhs,k,l)->simplify();
               eq->rhs = Element::New(rhs,k,l)->simplify();
               SymbolScanner scan(eq,m_time,m_incidencematrixT);
-              eq->lhs->scanExp(scan);
-              eq->rhs->scanExp(scan);
+              eq->lhs->walkExp(scan);
+              eq->rhs->walkExp(scan);
               m_equations.push_back(eq);
               meqns.push_back(eq);
             }
@@ -103,21 +105,20 @@ UnMatchedSystem::~UnMatchedSystem()
 /*****************************************************************************/
 
 /*****************************************************************************/
-bool UnMatchedSystem::SymbolScanner::process_Arg(BasicPtr const &p, bool &stop)
+bool UnMatchedSystem::SymbolScanner::enter(Basic const* p, bool &stop)
 /*****************************************************************************/
 {
   if (p->getType() == Type_Der)
   {
     if (inder)
       throw InternalError("Error: der(der(exp)) is not allowed!");
+    // zurueckgesetzt in leave
     inder = true;
-    p->getArg(0)->scanExp(*this);
-    inder = false;
-    return false;
+    return true;
   }
   if (p->getType() == Type_Symbol)
   {
-    Symbol *s = Util::getAsPtr<Symbol>(p);
+    Symbol *s = const_cast<Symbol*>(static_cast<const Symbol*>(p));
     if (m_time == static_cast<Basic*>(s))
       return true;
     if (inder)
@@ -161,7 +162,7 @@ bool UnMatchedSystem::SymbolScanner::process_Arg(BasicPtr const &p, bool &stop)
   {
     if (p->getArg(0)->getType() == Type_Symbol)
     {
-      Symbol *s = Util::getAsPtr<Symbol>(p->getArg(0));
+      Symbol *s = const_cast<Symbol*>(static_cast<const Symbol*>(p->getArg(0).get()));
       if (m_time == static_cast<Basic*>(s))
         return true;
       if (inder)
@@ -213,18 +214,12 @@ bool UnMatchedSystem::SymbolScanner::process_Arg(BasicPtr const &p, bool &stop)
 /*****************************************************************************/
 
 /*****************************************************************************/
-BasicPtr UnMatchedSystem::SymbolRepl::process_Arg(BasicPtr const &p)
+void UnMatchedSystem::SymbolScanner::leave(Basic const* p, bool &stop)
 /*****************************************************************************/
 {
-  if (p->getType() == Type_Symbol)
-  {
-    BasicPtrMap::iterator ii = m_symbolmap.find(p);
-    if (ii != m_symbolmap.end())
-      return ii->second;
-  }
-  return p;
+  if (p->getType() == Type_Der)
+    inder = false;
 }
-/*****************************************************************************/
 
 /*****************************************************************************/
 void UnMatchedSystem::addSymbolToIncidenceMatrix(SymbolPtr s)
@@ -244,6 +239,7 @@ void UnMatchedSystem::addSymbolToIncidenceMatrix(SymbolPtr s)
     if (s->is_Scalar())
     {
       MSymbol *symbol = new MSymbol(s,0,0);
+      symbol->id = m_symbolCount++;
       s->setUserData(static_cast<void*>(symbol),ID_UD_SYMBOL);
       if (state)
         m_states.insert(symbol);
@@ -262,6 +258,7 @@ void UnMatchedSystem::addSymbolToIncidenceMatrix(SymbolPtr s)
         for (size_t j=0;j<dim2;j++)
         {
           MSymbol *symbol = new MSymbol(s,i,j);
+          symbol->id = m_symbolCount++;
           if (s->is_State(i,j) & STATE)
           {
             m_states.insert(symbol);
@@ -301,7 +298,6 @@ void UnMatchedSystem::addSymbolToIncidenceMatrix(SymbolPtr s)
 void UnMatchedSystem::addEquationToIncidenceMatrix(MEquation* wrapper)
 /*****************************************************************************/
 {
-  SymbolRepl repl(symbolreplacemap);
   EquationPtr e = wrapper->eqn;
   SymbolPtrElemSizeTMap &symbols = e->getSymbols();
   for (SymbolPtrElemSizeTMap::iterator m=symbols.begin();m!=symbols.end();m++)
@@ -406,11 +402,14 @@ void UnMatchedSystem::buildNodes()
       */
       EquationPtrMEquationSetMap eqnchecker;
       EquationPtrVec eqns;
+      // MEquations je Gleichung fuer das Tearing
+      MEquationPtrVecVec units;
       for(size_t i=0;i<m_comps[e].size();i++)
       {
         if (m_comps[e][i]->eqn->getNumEl() == 1)
         {
           eqns.push_back(m_comps[e][i]->eqn);
+          units.push_back(MEquationPtrVec(1,m_comps[e][i]));
           if (m_comps[e][i]->symbol->symbol->is_Scalar())
           {
             // scalar case
@@ -457,6 +456,7 @@ void UnMatchedSystem::buildNodes()
             /* full multidim equation */
             ii->first->solve((*im)->symbol->symbol);
             eqns.push_back(ii->first);
+            units.push_back(MEquationPtrVec(ii->second.begin(),ii->second.end()));
             continue;
           }
         }
@@ -488,11 +488,12 @@ void UnMatchedSystem::buildNodes()
           else
             (*in)->eqn->solve(Element::New((*in)->symbol->symbol,(*in)->symbol->dim1,(*in)->symbol->dim2));
           eqns.push_back((*in)->eqn);
+          units.push_back(MEquationPtrVec(1,*in));
         }
       }
       EquationPtr eqn;
       if (eqns.size() > 1)
-        eqn = m_eqsys->combineEquations(eqns);
+        eqn = tearBlock(eqns,units);
       else
         eqn = eqns[0];
       NodePtr node = new Node(eqn,m_time);
@@ -508,6 +509,128 @@ void UnMatchedSystem::buildNodes()
 }
 /*****************************************************************************/
 
+/*****************************************************************************/
+EquationPtr UnMatchedSystem::tearBlock(EquationPtrVec const& eqns, MEquationPtrVecVec const& meqns)
+/*****************************************************************************/
+{
+  const size_t n = eqns.size();
+  // Gleichung des Blocks, die ein Symbol berechnet
+  std::map<MSymbol*,size_t> owner;
+  for (size_t u=0;u<n;++u)
+    for (size_t k=0;k<meqns[u].size();++k)
+      owner[meqns[u][k]->symbol] = u;
+  // benoetigte Gleichungen des Blocks je Gleichung
+  std::vector<SizeTVec> deps(n);
+  SizeTVec users(n,0);
+  // Gleichungen, die u benoetigen, und Anzahl noch offener Eingaenge
+  std::vector<SizeTVec> dependents(n);
+  SizeTVec pending(n,0);
+  for (size_t u=0;u<n;++u)
+  {
+    for (size_t k=0;k<meqns[u].size();++k)
+    {
+      MSymbolPtrSet &symbols = meqns[u][k]->symbols;
+      for (MSymbolPtrSet::iterator ii=symbols.begin();ii!=symbols.end();++ii)
+      {
+        std::map<MSymbol*,size_t>::iterator io = owner.find(*ii);
+        if ((io != owner.end()) && (io->second != u))
+          deps[u].push_back(io->second);
+      }
+    }
+    std::sort(deps[u].begin(),deps[u].end());
+    deps[u].erase(std::unique(deps[u].begin(),deps[u].end()),deps[u].end());
+    for (size_t d=0;d<deps[u].size();++d)
+    {
+      users[deps[u][d]]++;
+      dependents[deps[u][d]].push_back(u);
+    }
+    pending[u] = deps[u].size();
+  }
+
+  // explizit loesbare Gleichungen mit bekannten Eingaengen, die kleinste
+  // Nummer (Reihenfolge des Matchings) zuerst
+  std::priority_queue<size_t,SizeTVec,std::greater<size_t> > ready;
+  for (size_t u=0;u<n;++u)
+    if ((pending[u] == 0) && !eqns[u]->is_Implicit())
+      ready.push(u);
+
+  std::vector<char> done(n,0);
+  EquationPtrVec ordered;
+  EquationPtrVec residuals;
+  BasicPtrVec tearing;
+  size_t numResiduals = 0;
+  size_t left = n;
+  while (left > 0)
+  {
+    // alle explizit loesbaren Gleichungen, deren Eingaenge bekannt sind,
+    // in der Reihenfolge des Matchings zuweisen
+    while (!ready.empty())
+    {
+      size_t u = ready.top();
+      ready.pop();
+      done[u] = 1;
+      left--;
+      for (size_t d=0;d<deps[u].size();++d)
+        users[deps[u][d]]--;
+      ordered.push_back(eqns[u]);
+      for (size_t d=0;d<dependents[u].size();++d)
+      {
+        size_t w = dependents[u][d];
+        if ((--pending[w] == 0) && !done[w] && !eqns[w]->is_Implicit())
+          ready.push(w);
+      }
+    }
+    if (left == 0)
+      break;
+    // Tearing Gleichung waehlen: implizite zuerst, sonst die mit den meisten
+    // noch offenen Nutzern, bei Gleichstand die, auf die die erste offene
+    // Gleichung wartet
+    size_t tear = n;
+    for (size_t v=0;(v<n) && (tear==n);++v)
+      if (!done[v] && eqns[v]->is_Implicit())
+        tear = v;
+    if (tear == n)
+    {
+      for (size_t v=0;v<n;++v)
+      {
+        if (done[v])
+          continue;
+        for (size_t d=0;d<deps[v].size();++d)
+        {
+          size_t c = deps[v][d];
+          if (!done[c] && ((tear == n) || (users[c] > users[tear])))
+            tear = c;
+        }
+      }
+    }
+    if (tear == n)
+      throw InternalError("Tearing of block failed");
+    done[tear] = 1;
+    left--;
+    for (size_t d=0;d<deps[tear].size();++d)
+      users[deps[tear][d]]--;
+    residuals.push_back(eqns[tear]);
+    numResiduals += eqns[tear]->getLhsSize();
+    MEquation *meq = meqns[tear][0];
+    if ((meqns[tear].size() > 1) || meq->symbol->symbol->is_Scalar())
+      tearing.push_back(meq->symbol->symbol);
+    else
+      tearing.push_back(Element::New(meq->symbol->symbol,meq->symbol->dim1,meq->symbol->dim2));
+    // die Tearing Variable gilt als bekannt
+    for (size_t d=0;d<dependents[tear].size();++d)
+    {
+      size_t w = dependents[tear][d];
+      if ((--pending[w] == 0) && !done[w] && !eqns[w]->is_Implicit())
+        ready.push(w);
+    }
+  }
+  ordered.insert(ordered.end(),residuals.begin(),residuals.end());
+  EquationPtr eqn = m_eqsys->combineEquations(ordered);
+  eqn->setTearing(tearing,numResiduals);
+  return eqn;
+}
+/*****************************************************************************/
+
 /*****************************************************************************/
 double UnMatchedSystem::matchSystem()
 /*****************************************************************************/
@@ -533,24 +656,24 @@ double UnMatchedSystem::matchSystem()
   DerRepl dr;
   Equation::DerRepl drder;
   size_t fname=1;
-  SymbolRepl repl(symbolreplacemap);
   // for node in nodes
   for (size_t i=0;i<m_equations.size();++i)
   {
-    SizeTSet eqn_marks;
-    MSymbolPtrSet sym_marks;
     if (m_equations[i]->symbol != NULL)
     {
       m_equations[i]->symbol->eqn = i+1;
       continue;
     }
     //double t5 = Util::getTime();
-    if (!pathFound(i,eqn_marks,sym_marks,m_equations[i]->c))
+    if (!pathFound(i,m_equations[i]->c))
     {
       // reduce index or make eqn scalar
       MSymbolPtrSet states;
-      // get marged equations (eqn_marks)
-      for (SizeTSet::iterator jj=eqn_marks.begin();jj!=eqn_marks.end();jj++)
+      // get marged equations (eqn_marks), sortiert und ohne Duplikate
+      SizeTVec eqn_marks(m_markedEqns);
+      std::sort(eqn_marks.begin(),eqn_marks.end());
+      eqn_marks.erase(std::unique(eqn_marks.begin(),eqn_marks.end()),eqn_marks.end());
+      for (SizeTVec::iterator jj=eqn_marks.begin();jj!=eqn_marks.end();jj++)
       {
         // states in eqn
         for (MSymbolPtrSet::iterator s=m_equations[*jj]->states.begin();s!= m_equations[*jj]->states.end();s++)
@@ -573,11 +696,11 @@ double UnMatchedSystem::matchSystem()
           }
           MEquation* eq = new MEquation(deq,0,0);
           // add diff eqn
-          eq->lhs = deq->getLhs(0)->iterateExp(repl)->simplify();
-          eq->rhs = deq->getRhs(0)->iterateExp(repl)->simplify();
+          eq->lhs = deq->getLhs(0)->subs(symbolreplacemap)->simplify();
+          eq->rhs = deq->getRhs(0)->subs(symbolreplacemap)->simplify();
           SymbolScanner scan(eq,m_time,m_incidencematrixT);
-          eq->lhs->scanExp(scan);
-          eq->rhs->scanExp(scan);
+          eq->lhs->walkExp(scan);
+          eq->rhs->walkExp(scan);
           m_equations.push_back(eq);
           deqnchecker[deq].insert(SizeTPair(eq->dim1,eq->dim2));
           diffeqns.insert(*jj);
@@ -662,6 +785,8 @@ double UnMatchedSystem::matchSystem()
         (*ik)->states.erase(dummystate);
         (*ik)->symbols.insert(dummystate);
       }
+      // Gleichungen und Zustaende haben sich geaendert
+      m_rowsValid = false;
       i--;
       if (debugmode)
         toGraphML("d:/Temp/PendulumDAE" + str(fname) + ".graphml");
@@ -837,16 +962,7 @@ double UnMatchedSystem::matchSystem()
   if (debugmode)
     toGraphML("d:/Temp/PendulumDAE_matched.graphml");
   // sort equations
-  MEquationPtrVec stack;
-  m_comps.clear();
-  size_t i = 0;
-  for (size_t e=0;e<m_equations.size();++e)
-  {
-    if(m_equations[e]->number == 0)
-    {
-      strongConnect(i,m_equations[e],stack);
-    }
-  }
+  sortBlocks();
   if (debugmode)
   {
     toGraphML_Sorted("d:/Temp/PendulumDAE_sorted.graphml");
@@ -1149,119 +1265,232 @@ BasicPtr UnMatchedSystem::DerRepl::process_Arg(BasicPtr const &p)
 
 
 /*****************************************************************************/
-void UnMatchedSystem::strongConnect(size_t &i, MEquation* eqn,
-  MEquationPtrVec &stack)
+void UnMatchedSystem::sortBlocks()
 /*****************************************************************************/
 {
-  i = i+1;
-  eqn->number = i;
-  eqn->lowlink = i;
-  eqn->onStack = true;
-  stack.push_back(eqn);
-  // get all needed equations to calculate this equation
-  MSymbolPtrSet &symbols = eqn->symbols;
-  for (MSymbolPtrSet::iterator ii=symbols.begin();ii!=symbols.end();++ii)
+  const size_t n = m_equations.size();
+  // benoetigte Gleichungen je Gleichung als CSR (Reihenfolge der symbols Menge)
+  SizeTVec depStart;
+  SizeTVec deps;
+  depStart.reserve(n+1);
+  depStart.push_back(0);
+  for (size_t e=0;e<n;++e)
   {
-    if ((*ii) != eqn->symbol)
+    MEquation *eqn = m_equations[e];
+    for (MSymbolPtrSet::iterator ii=eqn->symbols.begin();ii!=eqn->symbols.end();++ii)
     {
-      size_t userdata = (*ii)->eqn;
-      if (userdata != 0)
+      if (((*ii) != eqn->symbol) && ((*ii)->eqn != 0))
+        deps.push_back((*ii)->eqn-1);
+    }
+    depStart.push_back(deps.size());
+  }
+
+  // Tarjan mit eigenem Stack, number == 0 heisst noch nicht besucht
+  SizeTVec number(n,0);
+  SizeTVec lowlink(n,0);
+  std::vector<char> onStack(n,0);
+  SizeTVec stack;
+  struct Frame
+  {
+    size_t eqn;
+    size_t pos;
+  };
+  std::vector<Frame> frames;
+  m_comps.clear();
+  m_maxBlockSize = 0;
+  size_t i = 0;
+  for (size_t root=0;root<n;++root)
+  {
+    if (number[root] != 0)
+      continue;
+    Frame fr = { root, depStart[root] };
+    frames.push_back(fr);
+    number[root] = lowlink[root] = ++i;
+    onStack[root] = 1;
+    stack.push_back(root);
+    while (frames.size() > 0)
+    {
+      Frame &top = frames.back();
+      const size_t e = top.eqn;
+      if (top.pos < depStart[e+1])
       {
-        MEquation *eq = m_equations[userdata-1];
-        if (eq->number == 0)
+        const size_t d = deps[top.pos++];
+        if (number[d] == 0)
         {
-          strongConnect(i,eq,stack);
-          if (eqn->lowlink > eq->lowlink)
-            eqn->lowlink = eq->lowlink;
+          Frame next = { d, depStart[d] };
+          frames.push_back(next);
+          number[d] = lowlink[d] = ++i;
+          onStack[d] = 1;
+          stack.push_back(d);
         }
-        else
+        else if ((number[e] > number[d]) && onStack[d])
         {
-          if (eqn->number > eq->number)
-          {
-            // on stack?
-            if (eq->onStack)
-            {
-              if (eqn->lowlink > eq->number)
-                eqn->lowlink = eq->number;
-              break;
-            }
-          }
+          if (lowlink[e] > number[d])
+            lowlink[e] = number[d];
+          // wie bisher: restliche Symbole nicht mehr betrachten
+          top.pos = depStart[e+1];
         }
+        continue;
       }
-    }
-  }
-  // check root
-  if (eqn->number == eqn->lowlink)
-  {
-    MEquationPtrVec comps;
-    while (stack.size() > 0)
-    {
-      if (stack[stack.size()-1]->number >= eqn->number)
+      frames.pop_back();
+      // check root
+      if (number[e] == lowlink[e])
       {
-        stack[stack.size()-1]->onStack = false;
-        comps.push_back(stack[stack.size()-1]);
-        stack.pop_back();
+        MEquationPtrVec comps;
+        while ((stack.size() > 0) && (number[stack.back()] >= number[e]))
+        {
+          onStack[stack.back()] = 0;
+          comps.push_back(m_equations[stack.back()]);
+          stack.pop_back();
+        }
+        if (comps.size() > 0)
+        {
+          if (comps.size() > m_maxBlockSize)
+            m_maxBlockSize = comps.size();
+          m_comps.push_back(comps);
+        }
+      }
+      if (frames.size() > 0)
+      {
+        const size_t p = frames.back().eqn;
+        if (lowlink[p] > lowlink[e])
+          lowlink[p] = lowlink[e];
       }
-      else
-        break;
     }
-    if (comps.size() > 0)
-      m_comps.push_back(comps);
   }
 }
 /*****************************************************************************/
 
 /*****************************************************************************/
-bool UnMatchedSystem::pathFound(size_t e, SizeTSet &eqn_mark, MSymbolPtrSet &sym_mark,size_t &c)
+void UnMatchedSystem::buildIncidenceRows()
 /*****************************************************************************/
 {
-  c++;
-  // mark eqn
-  eqn_mark.insert(e);
-  // try to find a free symbol
-  MSymbolPtrSet &eqnsymbols = m_equations[e]->symbols;
-  for (MSymbolPtrSet::iterator ii=eqnsymbols.begin();ii!=eqnsymbols.end();++ii)
+  m_rowStart.clear();
+  m_rowStart.reserve(m_equations.size()+1);
+  m_rowStart.push_back(0);
+  m_rowSymbols.clear();
+  for (size_t e=0;e<m_equations.size();++e)
   {
-    if ((*ii)->state || (*ii)->parameter)
-      continue;
-    // is not assigned
-    if ((*ii)->eqn == 0)
+    MSymbolPtrSet &eqnsymbols = m_equations[e]->symbols;
+    for (MSymbolPtrSet::iterator ii=eqnsymbols.begin();ii!=eqnsymbols.end();++ii)
     {
-      // assign
-      m_equations[e]->symbol = (*ii);
-      (*ii)->eqn = e+1;
-      return true;
+      if ((*ii)->state || (*ii)->parameter)
+        continue;
+      m_rowSymbols.push_back(*ii);
     }
+    m_rowStart.push_back(m_rowSymbols.size());
   }
-  // get all not marked symbols of equation
-  MSymbolPtrVec notmarkedsymbols;
-  notmarkedsymbols.reserve(eqnsymbols.size());
-  for (MSymbolPtrSet::iterator ii=eqnsymbols.begin();ii!=eqnsymbols.end();++ii)
+  m_rowsValid = true;
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+bool UnMatchedSystem::pathFound(size_t e, size_t &c)
+/*****************************************************************************/
+{
+  if (!m_rowsValid || (m_rowStart.size() != m_equations.size()+1))
+    buildIncidenceRows();
+  // neue Marke, alte Markierungen muessen nicht geloescht werden
+  ++m_markStamp;
+  if (m_symMark.size() < m_symbolCount)
+    m_symMark.resize(m_symbolCount,0);
+  m_markedEqns.clear();
+
+  // Tiefensuche mit eigenem Stack, gleiche Reihenfolge wie rekursiv:
+  // je Gleichung die beim Betreten noch nicht markierten Symbole
+  // (in notmarked[begin,end)) und das gerade versuchte Symbol j
+  struct Frame
   {
-   if ((*ii)->state || (*ii)->parameter)
-      continue;
-    if (sym_mark.find((*ii)) == sym_mark.end())
-      notmarkedsymbols.push_back((*ii));
-  }
-  // try to free a symbol 
-  for (size_t j=0;j<notmarkedsymbols.size();++j)
+    size_t eqn;
+    size_t begin;
+    size_t end;
+    size_t j;
+  };
+  std::vector<Frame> stack;
+  MSymbolPtrVec notmarked;
+  size_t next = e;
+  bool result = false;
+  for (;;)
   {
-    sym_mark.insert(notmarkedsymbols[j]);
-    size_t m = notmarkedsymbols[j]->eqn;
-    if (m != 0)
+    // Gleichung next betreten
+    c++;
+    m_markedEqns.push_back(next);
+    bool haveResult = false;
+    // try to find a free symbol
+    for (size_t k=m_rowStart[next];k<m_rowStart[next+1];++k)
     {
-      m_equations[m-1]->c1++;
-      if (pathFound(m-1,eqn_mark,sym_mark,c))
+      MSymbol *sym = m_rowSymbols[k];
+      // is not assigned
+      if (sym->eqn == 0)
       {
         // assign
-        m_equations[e]->symbol = notmarkedsymbols[j];
-        notmarkedsymbols[j]->eqn = e+1;
-        return true;
+        m_equations[next]->symbol = sym;
+        sym->eqn = next+1;
+        haveResult = true;
+        result = true;
+        break;
+      }
+    }
+    if (!haveResult)
+    {
+      // get all not marked symbols of equation
+      Frame f;
+      f.eqn = next;
+      f.begin = notmarked.size();
+      for (size_t k=m_rowStart[next];k<m_rowStart[next+1];++k)
+        if (m_symMark[m_rowSymbols[k]->id] != m_markStamp)
+          notmarked.push_back(m_rowSymbols[k]);
+      f.end = notmarked.size();
+      f.j = 0;
+      stack.push_back(f);
+    }
+
+    // Ergebnis weitergeben bzw. naechstes Symbol versuchen
+    for (;;)
+    {
+      if (haveResult)
+      {
+        if (stack.empty())
+          return result;
+        Frame &f = stack.back();
+        if (result)
+        {
+          // assign
+          MSymbol *sym = notmarked[f.begin+f.j];
+          m_equations[f.eqn]->symbol = sym;
+          sym->eqn = f.eqn+1;
+          notmarked.resize(f.begin);
+          stack.pop_back();
+          continue;
+        }
+        f.j++;
+        haveResult = false;
+      }
+      // try to free a symbol
+      Frame &f = stack.back();
+      size_t m = 0;
+      while ((f.begin+f.j) < f.end)
+      {
+        MSymbol *sym = notmarked[f.begin+f.j];
+        m_symMark[sym->id] = m_markStamp;
+        m = sym->eqn;
+        if (m != 0)
+          break;
+        f.j++;
+      }
+      if (m != 0)
+      {
+        m_equations[m-1]->c1++;
+        next = m-1;
+        break;
       }
+      // no succes
+      notmarked.resize(f.begin);
+      stack.pop_back();
+      haveResult = true;
+      result = false;
     }
   }
-  // no succes return false
-  return false;
 }
 /*****************************************************************************/
 
@@ -1592,6 +1821,7 @@ void UnMatchedSystem::dumpComps( std::string file )
     f << "No Comps!" << std::endl;
     return;
   }
+  f << "Blocks: " << getNumBlocks() << ", largest: " << getMaxBlockSize() << std::endl;
 
   for (size_t i=0;i<m_comps.size();i++)
   {
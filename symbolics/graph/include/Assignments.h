@@ -18,10 +18,13 @@ namespace Symbolics
 };
 
 /*****************************************************************************/
-namespace boost
+namespace Symbolics
 {
-    void intrusive_ptr_add_ref( const Symbolics::Graph::Assignments *p);
-    void intrusive_ptr_release( const Symbolics::Graph::Assignments *p);
+  namespace Graph
+  {
+      void intrusive_ptr_add_ref( const Symbolics::Graph::Assignments *p);
+      void intrusive_ptr_release( const Symbolics::Graph::Assignments *p);
+  };
 };
 /*****************************************************************************/
 
@@ -49,6 +52,9 @@ namespace Symbolics
             BasicPtrVec rhs;
             Category_Type category;
             bool implizit;
+            // Tearing: die letzten residuals Eintraege sind Residuen lhs - rhs = 0
+            BasicPtrVec tearing;
+            size_t residuals;
         };
 
 /*****************************************************************************/
@@ -69,33 +75,36 @@ namespace Symbolics
         // Boost Intrusive Ptr
         unsigned int m_refCount;
         // friend
-        friend void ::boost::intrusive_ptr_add_ref( const Assignments* p);
-        friend void ::boost::intrusive_ptr_release( const Assignments* p);
+        friend void intrusive_ptr_add_ref( const Assignments* p);
+        friend void intrusive_ptr_release( const Assignments* p);
         };
 /*****************************************************************************/
     };
 };
 
 /*****************************************************************************/
-namespace boost
+namespace Symbolics
 {
-    // increment reference count of object *p
-    inline void intrusive_ptr_add_ref( const Symbolics::Graph::Assignments* p)
-    {
-        // Muss sein, da ich sonst keine  Basics in intrusive Ptr legen kann
-        Symbolics::Graph::Assignments* b = const_cast<Symbolics::Graph::Assignments*>(p);
-        ++(b->m_refCount);
-    }
-
-    // decrement reference count, and delete object when reference count reaches 0
-    inline void intrusive_ptr_release( const Symbolics::Graph::Assignments* p)
-    {
-        // Muss sein, da ich sonst keine  Basics in intrusive Ptr legen kann
-        Symbolics::Graph::Assignments* b = const_cast<Symbolics::Graph::Assignments*>(p);
-        if (--(b->m_refCount) == 0)
-            delete p;
-    } 
-}; // namespace boost
+  namespace Graph
+  {
+      // increment reference count of object *p
+      inline void intrusive_ptr_add_ref( const Symbolics::Graph::Assignments* p)
+      {
+          // Muss sein, da ich sonst keine  Basics in intrusive Ptr legen kann
+          Symbolics::Graph::Assignments* b = const_cast<Symbolics::Graph::Assignments*>(p);
+          ++(b->m_refCount);
+      }
+
+      // decrement reference count, and delete object when reference count reaches 0
+      inline void intrusive_ptr_release( const Symbolics::Graph::Assignments* p)
+      {
+          // Muss sein, da ich sonst keine  Basics in intrusive Ptr legen kann
+          Symbolics::Graph::Assignments* b = const_cast<Symbolics::Graph::Assignments*>(p);
+          if (--(b->m_refCount) == 0)
+              delete p;
+      } 
+  };
+}; // namespace Symbolics
 /*****************************************************************************/
 
 #endif // __GRAPH_ASSIGNMENT_H_
@@ -17,10 +17,13 @@ namespace Symbolics
 };
 
 /*****************************************************************************/
-namespace boost
+namespace Symbolics
 {
-  void intrusive_ptr_add_ref( const Symbolics::Graph::Equation *p);
-  void intrusive_ptr_release( const Symbolics::Graph::Equation *p);
+  namespace Graph
+  {
+    void intrusive_ptr_add_ref( const Symbolics::Graph::Equation *p);
+    void intrusive_ptr_release( const Symbolics::Graph::Equation *p);
+  };
 };
 /*****************************************************************************/
 
@@ -69,6 +72,10 @@ namespace Symbolics
       // Destruktor
       virtual ~Equation();
 
+      // Speicher aus der Arena des aktuellen Scopes
+      static inline void* operator new( size_t size ) { return Arena::allocate(size); };
+      static inline void operator delete( void *p, size_t size ) { Arena::deallocate(p,size); };
+
       // returns the symbols
       inline  SymbolPtrElemSizeTMap& getSymbols()  {return m_symbols; };
       inline  SymbolPtrElemMap& getSolveFor()  {return m_solveFor; };
@@ -87,6 +94,8 @@ namespace Symbolics
 
       // subs
       void subs(ConstBasicPtr const& old_exp, BasicPtr const& new_exp);
+      // mehrere Ersetzungen in einem Durchlauf
+      void subs(BasicPtrMap const& repl);
 
       void simplify();
 
@@ -99,6 +108,13 @@ namespace Symbolics
       // Gesamtgroesse
       inline size_t getNumEl() const { return m_numElem; };
 
+      // Tearing: die letzten numResiduals Eintraege von lhs/rhs sind Residuen
+      // (lhs - rhs = 0) fuer die Tearing Variablen, die davor stehenden
+      // Zuweisungen werden der Reihe nach mit diesen berechnet
+      void setTearing(BasicPtrVec const& tearing, size_t numResiduals);
+      inline BasicPtrVec const& getTearing() const { return m_tearing; };
+      inline size_t getNumResiduals() const { return m_numResiduals; };
+
       // differentiate eqn
       EquationPtr diff();
 
@@ -119,16 +135,20 @@ namespace Symbolics
       Category_Type m_category;
       // Number of Elements
       size_t m_numElem;
+      // Tearing Variablen und Anzahl der Residuen
+      BasicPtrVec m_tearing;
+      size_t m_numResiduals;
 
       void setSolveFor(SymbolPtrElemMap const& SolveFor);
 
-      class DerivativeScanner: public Basic::Scanner
+      class DerivativeScanner: public Basic::Walker
       {
       public:
         DerivativeScanner(SymbolPtrElemSizeTMap &symbols): atoms(symbols),inder(false),inelement(false) {;}
         ~DerivativeScanner() {;}
 
-        bool process_Arg(BasicPtr const &p, bool &stop);
+        bool enter(Basic const* p, bool &stop);
+        void leave(Basic const* p, bool &stop);
 
         SymbolPtrElemSizeTMap &atoms;
 
@@ -139,14 +159,15 @@ namespace Symbolics
         size_t dim2;
       };
 
-      class SymbolScanner: public Basic::Scanner
+      class SymbolScanner: public Basic::Walker
       {
       public:
         SymbolScanner(SymbolPtrElemMap &symbols, bool errorIfMoreThanOnce=false): 
             atoms(symbols),inder(false),errorifmorethanonce(errorIfMoreThanOnce),inelement(false),dim1(0),dim2(0) {;}
             ~SymbolScanner() {;}
 
-            bool process_Arg(BasicPtr const &p, bool &stop);
+            bool enter(Basic const* p, bool &stop);
+            void leave(Basic const* p, bool &stop);
 
             SymbolPtrElemMap &atoms;
 
@@ -173,8 +194,8 @@ namespace Symbolics
       // Boost Intrusive Ptr
       unsigned int m_refCount;
       // friend
-      friend void ::boost::intrusive_ptr_add_ref( const Equation* p);
-      friend void ::boost::intrusive_ptr_release( const Equation* p);
+      friend void intrusive_ptr_add_ref( const Equation* p);
+      friend void intrusive_ptr_release( const Equation* p);
     };
     /*****************************************************************************/
   };
@@ -182,24 +203,27 @@ namespace Symbolics
 };
 
 /*****************************************************************************/
-namespace boost
+namespace Symbolics
 {
-  // increment reference count of object *p
-  inline void intrusive_ptr_add_ref( const Symbolics::Graph::Equation* p)
+  namespace Graph
   {
-    // Muss sein, da ich sonst keine  Basics in intrusive Ptr legen kann
-    Symbolics::Graph::Equation* b = const_cast<Symbolics::Graph::Equation*>(p);
-    ++(b->m_refCount);
-  }
+    // increment reference count of object *p
+    inline void intrusive_ptr_add_ref( const Symbolics::Graph::Equation* p)
+    {
+      // Muss sein, da ich sonst keine  Basics in intrusive Ptr legen kann
+      Symbolics::Graph::Equation* b = const_cast<Symbolics::Graph::Equation*>(p);
+      ++(b->m_refCount);
+    }
 
-  // decrement reference count, and delete object when reference count reaches 0
-  inline void intrusive_ptr_release( const Symbolics::Graph::Equation* p)
-  {
-    // Muss sein, da ich sonst keine  Basics in intrusive Ptr legen kann
-    Symbolics::Graph::Equation* b = const_cast<Symbolics::Graph::Equation*>(p);
-    if (--(b->m_refCount) == 0)
-      delete p;
-  } 
-}; // namespace boost
+    // decrement reference count, and delete object when reference count reaches 0
+    inline void intrusive_ptr_release( const Symbolics::Graph::Equation* p)
+    {
+      // Muss sein, da ich sonst keine  Basics in intrusive Ptr legen kann
+      Symbolics::Graph::Equation* b = const_cast<Symbolics::Graph::Equation*>(p);
+      if (--(b->m_refCount) == 0)
+        delete p;
+    } 
+  };
+}; // namespace Symbolics
 /*****************************************************************************/
 #endif // __GRAPH_EQUATION_H_
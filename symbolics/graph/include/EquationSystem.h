@@ -18,10 +18,13 @@ namespace Symbolics
 };
 
 /*****************************************************************************/
-namespace boost
+namespace Symbolics
 {
-  void intrusive_ptr_add_ref( const Symbolics::Graph::EquationSystem *p);
-  void intrusive_ptr_release( const Symbolics::Graph::EquationSystem *p);
+  namespace Graph
+  {
+    void intrusive_ptr_add_ref( const Symbolics::Graph::EquationSystem *p);
+    void intrusive_ptr_release( const Symbolics::Graph::EquationSystem *p);
+  };
 };
 /*****************************************************************************/
 
@@ -111,7 +114,7 @@ namespace Symbolics
       // getSymbol
       // throws: VarUnknownError
       SymbolPtr getSymbol( std::string const& name);
-      inline bool hasSymbol( std::string const& name) { return m_SymbolMap.find(name) != m_SymbolMap.end(); };
+      inline bool hasSymbol( std::string const& name) { return findSymbol(Symbol::findId(name)) != NULL; };
 
       // getVariables
       SymbolPtrVec getVariables(Symbol_Kind kind);
@@ -159,6 +162,9 @@ namespace Symbolics
       SymbolEquationMap m_symbolsequationmap;
       // ["Symbol"] = Symbol
       StringSymbolMap m_SymbolMap;
+      // [Symbol-Id] = Symbol, fuer die Suche ohne Stringvergleich
+      std::vector<Symbol*> m_SymbolById;
+      inline Symbol* findSymbol( size_t id ) const { return (id < m_SymbolById.size()) ? m_SymbolById[id] : NULL; };
       // [Symbol] = startvalue
       typedef std::map<SymbolPtr,BasicPtr> SymbolStartValueMap;
       SymbolStartValueMap m_symbolsvaluemap;
@@ -192,24 +198,25 @@ namespace Symbolics
       void assignEqnstoSymbols(SymbolPtrElemMap &symbols, EquationPtr eqn);
 
 
-      class InitValueScanner: public Basic::Scanner
+      class InitValueScanner: public Basic::Walker
       {
       public:
         InitValueScanner(): variable(false) {;}
         ~InitValueScanner() {;}
                 
-        bool process_Arg(BasicPtr const &p, bool &stop);
+        bool enter(Basic const* p, bool &stop);
 
         bool variable;
       };
 
-      class DerivativeScanner: public Basic::Scanner
+      class DerivativeScanner: public Basic::Walker
       {
       public:
           DerivativeScanner():inder(false),inelement(false),dim1(0),dim2(0) {;}
           ~DerivativeScanner() {;}
                 
-          bool process_Arg(BasicPtr const &p, bool &stop);
+          bool enter(Basic const* p, bool &stop);
+          void leave(Basic const* p, bool &stop);
 
           SymbolPtrElemMap atoms;
           SymbolPtrElemMap states;
@@ -220,30 +227,25 @@ namespace Symbolics
           size_t dim1;
           size_t dim2;
 
-          void process_derArg(BasicPtr const &p);
+          void process_derArg(Basic const* p);
           void addAtom(SymbolPtr sp);
       };
 
-      class SymbolRepl: public Basic::Iterator
-      {
-      public:
-          SymbolRepl(BasicPtrMap &symbolmap):m_symbolmap(symbolmap) {;}
-          ~SymbolRepl() {;}
-          
-          BasicPtrMap &m_symbolmap;
-
-          BasicPtr process_Arg(BasicPtr const &p);
-      };
 
       void checkEquation(DerivativeScanner *scanner,
         BasicPtr const& exp, BasicPtrVec const& expvec, bool implicit, SymbolPtrElemMap &symbols);
 
+      // zerlegten Block (Tearing) als eine implizite Gleichung einfuegen,
+      // die letzten numResiduals Eintraege sind Residuen
+      void addTornEquation( BasicPtrVec const& lhs, BasicPtrVec const& rhs,
+        BasicPtrVec const& tearing, size_t numResiduals);
+
     private:
       // Boost Intrusive Ptr
       unsigned int m_refCount;
       // friend
-      friend void ::boost::intrusive_ptr_add_ref( const EquationSystem* p);
-      friend void ::boost::intrusive_ptr_release( const EquationSystem* p);
+      friend void intrusive_ptr_add_ref( const EquationSystem* p);
+      friend void intrusive_ptr_release( const EquationSystem* p);
 
     };
 /*****************************************************************************/
@@ -252,25 +254,28 @@ namespace Symbolics
 };
 
 /*****************************************************************************/
-namespace boost
+namespace Symbolics
 {
-  // increment reference count of object *p
-  inline void intrusive_ptr_add_ref( const Symbolics::Graph::EquationSystem* p)
+  namespace Graph
   {
-    // Muss sein, da ich sonst keine  Basics in intrusive Ptr legen kann
-    Symbolics::Graph::EquationSystem* b = const_cast<Symbolics::Graph::EquationSystem*>(p);
-    ++(b->m_refCount);
-  }
+    // increment reference count of object *p
+    inline void intrusive_ptr_add_ref( const Symbolics::Graph::EquationSystem* p)
+    {
+      // Muss sein, da ich sonst keine  Basics in intrusive Ptr legen kann
+      Symbolics::Graph::EquationSystem* b = const_cast<Symbolics::Graph::EquationSystem*>(p);
+      ++(b->m_refCount);
+    }
 
-  // decrement reference count, and delete object when reference count reaches 0
-  inline void intrusive_ptr_release( const Symbolics::Graph::EquationSystem* p)
-  {
-    // Muss sein, da ich sonst keine  Basics in intrusive Ptr legen kann
-    Symbolics::Graph::EquationSystem* b = const_cast<Symbolics::Graph::EquationSystem*>(p);
-    if (--(b->m_refCount) == 0)
-      delete p;
-  } 
-}; // namespace boost
+    // decrement reference count, and delete object when reference count reaches 0
+    inline void intrusive_ptr_release( const Symbolics::Graph::EquationSystem* p)
+    {
+      // Muss sein, da ich sonst keine  Basics in intrusive Ptr legen kann
+      Symbolics::Graph::EquationSystem* b = const_cast<Symbolics::Graph::EquationSystem*>(p);
+      if (--(b->m_refCount) == 0)
+        delete p;
+    } 
+  };
+}; // namespace Symbolics
 /*****************************************************************************/
 
 #endif // __GRAPH_EQUATIONSYSTEM_H_
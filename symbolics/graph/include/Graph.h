@@ -67,6 +67,9 @@ namespace Symbolics
             // to GraphML
             void toGraphML( std::string file );
 
+            // Speicher (Bytes), den die Arena dieses Graphen haelt
+            inline size_t getArenaMemory() const { return m_arena->getReserved(); };
+
         protected:
           EquationSystemPtr eqsys;
           SystemHandlerPtr m_syshandler;
@@ -92,6 +95,8 @@ namespace Symbolics
 
         private:
             BasicPtr m_time;
+            // Arena des Scopes, aus der alle Ausdruecke des Graphen kommen
+            ArenaPtr m_arena;
          };
 /*****************************************************************************/
     };
@@ -18,10 +18,13 @@ namespace Symbolics
 };
 
 /*****************************************************************************/
-namespace boost
+namespace Symbolics
 {
-  void intrusive_ptr_add_ref( const Symbolics::Graph::Node *p);
-  void intrusive_ptr_release( const Symbolics::Graph::Node *p);
+  namespace Graph
+  {
+    void intrusive_ptr_add_ref( const Symbolics::Graph::Node *p);
+    void intrusive_ptr_release( const Symbolics::Graph::Node *p);
+  };
 };
 /*****************************************************************************/
 
@@ -59,6 +62,10 @@ namespace Symbolics
       // Destruktor
       virtual ~Node();
 
+      // Speicher aus der Arena des aktuellen Scopes
+      static inline void* operator new( size_t size ) { return Arena::allocate(size); };
+      static inline void operator delete( void *p, size_t size ) { Arena::deallocate(p,size); };
+
       // returns the symbols
       inline  SymbolPtrElemSizeTMap& getSymbols()  {return m_eqn->getSymbols(); };
       inline  SymbolPtrElemMap& getSolveFor()  {return m_eqn->getSolveFor(); };
@@ -69,6 +76,8 @@ namespace Symbolics
       inline size_t getRhsSize() { return m_eqn->getRhsSize(); };
       inline  BasicPtr const& getRhs(size_t i)  { return m_eqn->getRhs(i); };
       inline  bool is_Implicit()  { return m_eqn->is_Implicit(); };
+      inline  BasicPtrVec const& getTearing()  { return m_eqn->getTearing(); };
+      inline  size_t getNumResiduals()  { return m_eqn->getNumResiduals(); };
       inline  Category_Type get_Category()  { return m_eqn->get_Category(); };
 
       // return the parents
@@ -90,8 +99,8 @@ namespace Symbolics
       // clear
       inline void clearChilds() { m_childs.clear(); };
 
-      // visited
-      bool visited;
+      // Index im NodeGraph
+      size_t id;
 
       void simplify();
       bool m_subsed;
@@ -102,6 +111,7 @@ namespace Symbolics
 
       // subs
       void subs(ConstBasicPtr const& old_exp, BasicPtr const& new_exp);
+      void subs(BasicPtrMap const& repl);
 
       class Visitor
       {
@@ -112,8 +122,6 @@ namespace Symbolics
         virtual ~Visitor() {};
       };
 
-      static void node_iterate_depth_first(NodePtr p, Visitor &v);
-
       inline std::string toString() { return m_eqn->toString();};
 
       inline EquationPtr getEqn() { return m_eqn; };
@@ -138,8 +146,34 @@ namespace Symbolics
       // Boost Intrusive Ptr
       unsigned int m_refCount;
       // friend
-      friend void ::boost::intrusive_ptr_add_ref( const Node* p);
-      friend void ::boost::intrusive_ptr_release( const Node* p);
+      friend void intrusive_ptr_add_ref( const Node* p);
+      friend void intrusive_ptr_release( const Node* p);
+    };
+    /*****************************************************************************/
+
+    /*****************************************************************************/
+    // Knoten mit dichten Indizes, Eltern als CSR Arrays; Momentaufnahme der
+    // Kanten beim Aufbau, die Traversierung kommt ohne Rekursion und ohne
+    // Allokation pro Knoten aus
+    class NodeGraph
+    {
+    public:
+      NodeGraph(NodeVec const& nodes);
+
+      // alle noch nicht besuchten Vorfahren von root und root selbst,
+      // Eltern vor Kindern
+      void iterate_depth_first(size_t root, Node::Visitor &v);
+
+      inline bool is_Visited(size_t i) const { return m_visited[i] != 0; };
+
+    protected:
+      NodeVec m_nodes;
+      // Eltern von Knoten i: m_parents[m_parentStart[i]..m_parentStart[i+1])
+      std::vector<size_t> m_parentStart;
+      std::vector<size_t> m_parents;
+      std::vector<char> m_visited;
+      // Knoten und naechster Elternindex
+      std::vector<SizeTPair> m_stack;
     };
     /*****************************************************************************/
   };
@@ -147,24 +181,27 @@ namespace Symbolics
 };
 
 /*****************************************************************************/
-namespace boost
+namespace Symbolics
 {
-  // increment reference count of object *p
-  inline void intrusive_ptr_add_ref( const Symbolics::Graph::Node* p)
+  namespace Graph
   {
-    // Muss sein, da ich sonst keine  Basics in intrusive Ptr legen kann
-    Symbolics::Graph::Node* b = const_cast<Symbolics::Graph::Node*>(p);
-    ++(b->m_refCount);
-  }
+    // increment reference count of object *p
+    inline void intrusive_ptr_add_ref( const Symbolics::Graph::Node* p)
+    {
+      // Muss sein, da ich sonst keine  Basics in intrusive Ptr legen kann
+      Symbolics::Graph::Node* b = const_cast<Symbolics::Graph::Node*>(p);
+      ++(b->m_refCount);
+    }
 
-  // decrement reference count, and delete object when reference count reaches 0
-  inline void intrusive_ptr_release( const Symbolics::Graph::Node* p)
-  {
-    // Muss sein, da ich sonst keine  Basics in intrusive Ptr legen kann
-    Symbolics::Graph::Node* b = const_cast<Symbolics::Graph::Node*>(p);
-    if (--(b->m_refCount) == 0)
-      delete p;
-  } 
-}; // namespace boost
+    // decrement reference count, and delete object when reference count reaches 0
+    inline void intrusive_ptr_release( const Symbolics::Graph::Node* p)
+    {
+      // Muss sein, da ich sonst keine  Basics in intrusive Ptr legen kann
+      Symbolics::Graph::Node* b = const_cast<Symbolics::Graph::Node*>(p);
+      if (--(b->m_refCount) == 0)
+        delete p;
+    } 
+  };
+}; // namespace Symbolics
 /*****************************************************************************/
 #endif // __GRAPH_NODE_H_
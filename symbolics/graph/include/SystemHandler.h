@@ -16,10 +16,13 @@ namespace Symbolics
 };
 
 /*****************************************************************************/
-namespace boost
+namespace Symbolics
 {
-  void intrusive_ptr_add_ref( const Symbolics::Graph::SystemHandler *p);
-  void intrusive_ptr_release( const Symbolics::Graph::SystemHandler *p);
+  namespace Graph
+  {
+    void intrusive_ptr_add_ref( const Symbolics::Graph::SystemHandler *p);
+    void intrusive_ptr_release( const Symbolics::Graph::SystemHandler *p);
+  };
 };
 /*****************************************************************************/
 
@@ -51,31 +54,34 @@ namespace Symbolics
       // Boost Intrusive Ptr
       unsigned int m_refCount;
       // friend
-      friend void ::boost::intrusive_ptr_add_ref( const SystemHandler* p);
-      friend void ::boost::intrusive_ptr_release( const SystemHandler* p);
+      friend void intrusive_ptr_add_ref( const SystemHandler* p);
+      friend void intrusive_ptr_release( const SystemHandler* p);
     };
 /*****************************************************************************/
   };
 };
 /*****************************************************************************/
-namespace boost
+namespace Symbolics
 {
-  // increment reference count of object *p
-  inline void intrusive_ptr_add_ref( const Symbolics::Graph::SystemHandler* p)
+  namespace Graph
   {
-    // Muss sein, da ich sonst keine  Basics in intrusive Ptr legen kann
-    Symbolics::Graph::SystemHandler* b = const_cast<Symbolics::Graph::SystemHandler*>(p);
-    ++(b->m_refCount);
-  }
+    // increment reference count of object *p
+    inline void intrusive_ptr_add_ref( const Symbolics::Graph::SystemHandler* p)
+    {
+      // Muss sein, da ich sonst keine  Basics in intrusive Ptr legen kann
+      Symbolics::Graph::SystemHandler* b = const_cast<Symbolics::Graph::SystemHandler*>(p);
+      ++(b->m_refCount);
+    }
 
-  // decrement reference count, and delete object when reference count reaches 0
-  inline void intrusive_ptr_release( const Symbolics::Graph::SystemHandler* p)
-  {
-    // Muss sein, da ich sonst keine  Basics in intrusive Ptr legen kann
-    Symbolics::Graph::SystemHandler* b = const_cast<Symbolics::Graph::SystemHandler*>(p);
-    if (--(b->m_refCount) == 0)
-      delete p;
-  } 
-}; // namespace boost
+    // decrement reference count, and delete object when reference count reaches 0
+    inline void intrusive_ptr_release( const Symbolics::Graph::SystemHandler* p)
+    {
+      // Muss sein, da ich sonst keine  Basics in intrusive Ptr legen kann
+      Symbolics::Graph::SystemHandler* b = const_cast<Symbolics::Graph::SystemHandler*>(p);
+      if (--(b->m_refCount) == 0)
+        delete p;
+    } 
+  };
+}; // namespace Symbolics
 /*****************************************************************************/
 #endif // __SYSTEMHANDLER_H_
@@ -29,6 +29,10 @@ namespace Symbolics
 
       void dumpComps( std::string file );
 
+      // Anzahl der Bloecke nach der Sortierung und Groesse des groessten Blocks
+      inline size_t getNumBlocks() const { return m_comps.size(); };
+      inline size_t getMaxBlockSize() const { return m_maxBlockSize; };
+
     protected:
 
       struct MSymbol
@@ -39,10 +43,17 @@ namespace Symbolics
         size_t dim2;
         bool state;
         bool parameter;
-        MSymbol(SymbolPtr s, size_t d1, size_t d2): symbol(s), eqn(0),dim1(d1),dim2(d2), state(false), parameter(false) {;};
+        // fortlaufende Nummer fuer die Markierungen beim Matching
+        size_t id;
+        MSymbol(SymbolPtr s, size_t d1, size_t d2): symbol(s), eqn(0),dim1(d1),dim2(d2), state(false), parameter(false), id(0) {;};
       };
       typedef MSymbol* MSymbolPtr;
-      typedef std::set<MSymbolPtr> MSymbolPtrSet;
+      // nach Nummer sortiert, damit das Matching nicht von den Adressen abhaengt
+      struct MSymbolLess
+      {
+        inline bool operator()(MSymbol const* a, MSymbol const* b) const { return a->id < b->id; };
+      };
+      typedef std::set<MSymbolPtr,MSymbolLess> MSymbolPtrSet;
       typedef std::vector<MSymbolPtr> MSymbolPtrVec;
 
       struct MEquation
@@ -54,14 +65,11 @@ namespace Symbolics
         size_t dim2;
         MSymbolPtrSet symbols;
         MSymbolPtrSet states;
-        size_t number;
-        size_t lowlink;
         MSymbol *symbol;
-        bool onStack;
         double t;
         size_t c;
         size_t c1;
-        MEquation(EquationPtr e, size_t d1, size_t d2): eqn(e),dim1(d1),dim2(d2),number(0),lowlink(0),symbol(NULL),onStack(false),t(0.0),c(0),c1(0) {;}; 
+        MEquation(EquationPtr e, size_t d1, size_t d2): eqn(e),dim1(d1),dim2(d2),symbol(NULL),t(0.0),c(0),c1(0) {;}; 
       };
       typedef std::vector<MEquation*> MEquationPtrVec;
       MEquationPtrVec m_equations;
@@ -83,20 +91,40 @@ namespace Symbolics
 
       std::map<BasicPtr,BasicPtr > symbolreplacemap;
 
-      typedef std::map<MSymbol*,size_t> SymbolEqnMap;
+      // Kandidaten fuer Dummy Zustaende, ebenfalls nach Nummer sortiert
+      typedef std::map<MSymbol*,size_t,MSymbolLess> SymbolEqnMap;
       typedef std::map<size_t,MSymbol*> EqnSymbolMap;
 
       double matchSystem();
 
       typedef std::set<size_t> SizeTSet;
-      bool pathFound(size_t e, SizeTSet &eqn_mark, MSymbolPtrSet &sym_mark,size_t &c);
-
       typedef std::vector<size_t> SizeTVec;
+      // augmentierender Pfad ab Gleichung e, ohne Rekursion
+      bool pathFound(size_t e, size_t &c);
+
+      // Symbole je Gleichung (ohne Zustaende und Parameter) als CSR, die
+      // Reihenfolge ist die der symbols Menge
+      SizeTVec m_rowStart;
+      MSymbolPtrVec m_rowSymbols;
+      bool m_rowsValid;
+      void buildIncidenceRows();
+      // Markierungen der Symbole je Suche (Suche gilt als markiert, wenn
+      // der Eintrag gleich m_markStamp ist), besuchte Gleichungen
+      SizeTVec m_symMark;
+      size_t m_markStamp;
+      SizeTVec m_markedEqns;
+      size_t m_symbolCount;
       typedef std::list<size_t> SizeTList;
-      void strongConnect(size_t &i, MEquation* eqn, MEquationPtrVec &stack);
+      // BLT Sortierung (Tarjan ohne Rekursion) ueber Indexfelder, fuellt m_comps
+      void sortBlocks();
+      size_t m_maxBlockSize;
 
       void buildNodes();
 
+      // Tearing eines Blocks: moeglichst wenige Gleichungen bleiben als
+      // Residuen, der Rest wird in berechenbarer Reihenfolge zugewiesen
+      EquationPtr tearBlock(EquationPtrVec const& eqns, MEquationPtrVecVec const& meqns);
+
       void addSymbolToIncidenceMatrix(SymbolPtr s);
 
       void addEquationToIncidenceMatrix(MEquation* wrapper);
@@ -116,18 +144,8 @@ namespace Symbolics
           BasicPtr process_Arg(BasicPtr const &p);
       };
 
-      class SymbolRepl: public Basic::Iterator
-      {
-      public:
-          SymbolRepl(BasicPtrMap &symbolmap):m_symbolmap(symbolmap) {;}
-          ~SymbolRepl() {;}
-          
-          BasicPtrMap &m_symbolmap;
-
-          BasicPtr process_Arg(BasicPtr const &p);
-      };
 
-      class SymbolScanner: public Basic::Scanner
+      class SymbolScanner: public Basic::Walker
       {
       public:
           SymbolScanner(MEquation* equation,
@@ -135,7 +153,8 @@ namespace Symbolics
             m_equation(equation), m_time(time),
             m_incidencematrixT(incidencematrixT),inder(false) {;}
           ~SymbolScanner() {;}
-          bool process_Arg(BasicPtr const &p, bool &stop);
+          bool enter(Basic const* p, bool &stop);
+          void leave(Basic const* p, bool &stop);
 
       protected:
           bool inder;
@@ -1,9 +1,108 @@
 #include <iostream>
+#include <sstream>
+#include <algorithm>
 #include "Symbolics.h"
 #include "Graph.h"
+#include "UnMatchedSystem.h"
 
 using namespace Symbolics;
 
+// Zugriff auf das UnMatchedSystem nach buildGraph
+class BlockGraph: public Graph::Graph
+{
+public:
+  Symbolics::Graph::UnMatchedSystem* getUnMatchedSystem()
+  {
+    return dynamic_cast<Symbolics::Graph::UnMatchedSystem*>(m_syshandler.get());
+  }
+  Symbolics::Graph::EquationSystemPtr getEquationSystem() { return eqsys; }
+};
+
+// Zugriff auf das Matching (pathFound, markierte Gleichungen)
+class MatchSystem: public Graph::UnMatchedSystem
+{
+public:
+  MatchSystem(Graph::EquationSystemPtr eqsys, Graph::NodeVec& nodes): UnMatchedSystem(eqsys,nodes) {}
+
+  MSymbol* getMSymbol(SymbolPtr const& s)
+  {
+    return static_cast<MSymbol*>(s->getUserData(ID_UD_SYMBOL));
+  }
+
+  // Gleichung mit Symbol s, mit bzw. ohne Zustaende und size Unbekannten
+  size_t findEquation(MSymbol *s, bool states, size_t size)
+  {
+    for (size_t i=0;i<m_equations.size();++i)
+    {
+      MSymbolPtrSet &symbols = m_equations[i]->symbols;
+      if (symbols.find(s) == symbols.end()) continue;
+      if (m_equations[i]->states.empty() == states) continue;
+      size_t unknowns = 0;
+      for (MSymbolPtrSet::iterator ii=symbols.begin();ii!=symbols.end();++ii)
+        if (!(*ii)->parameter) unknowns++;
+      if (unknowns != size) continue;
+      return i;
+    }
+    return m_equations.size();
+  }
+
+  // markierte Gleichungen der letzten Suche, sortiert
+  SizeTVec getMarked()
+  {
+    SizeTVec marked(m_markedEqns);
+    std::sort(marked.begin(),marked.end());
+    return marked;
+  }
+
+  int run(SymbolPtr const& a, SymbolPtr const& b, SymbolPtr const& p, SymbolPtr const& q)
+  {
+    MSymbol *ma = getMSymbol(a);
+    MSymbol *mb = getMSymbol(b);
+    MSymbol *mp = getMSymbol(p);
+    MSymbol *mq = getMSymbol(q);
+    // Reihenfolge der Symbole nach Erzeugung, nicht nach Adresse
+    if (!(mp->id < mq->id)) return -21;
+    size_t n = m_equations.size();
+    size_t e1 = findEquation(mb,true,1);
+    size_t e2 = findEquation(mb,false,1);
+    size_t e3 = findEquation(mp,false,2);
+    size_t e4 = findEquation(mp,false,1);
+    if ((e1 == n) || (e2 == n) || (e3 == n) || (e4 == n)) return -22;
+
+    size_t c = 0;
+    // b - x: b ist frei
+    if (!pathFound(e1,c)) return -23;
+    if ((m_equations[e1]->symbol != mb) || (mb->eqn != e1+1)) return -24;
+    // b - c: b ist vergeben und e1 hat kein anderes Symbol, beide markiert
+    if (pathFound(e2,c)) return -25;
+    SizeTVec marked = getMarked();
+    if ((marked.size() != 2) || (marked[0] != std::min(e1,e2)) || (marked[1] != std::max(e1,e2))) return -26;
+    if ((m_equations[e2]->symbol != NULL) || (mb->eqn != e1+1)) return -27;
+    // p + q: das erste freie Symbol ist p
+    if (!pathFound(e3,c)) return -28;
+    if (m_equations[e3]->symbol != mp) return -29;
+    // p - c: augmentierender Pfad ueber e3, e3 bekommt q
+    if (!pathFound(e4,c)) return -30;
+    if ((m_equations[e4]->symbol != mp) || (m_equations[e3]->symbol != mq)) return -31;
+    if ((mp->eqn != e4+1) || (mq->eqn != e3+1)) return -32;
+    marked = getMarked();
+    if ((marked.size() != 2) || (marked[0] != std::min(e3,e4)) || (marked[1] != std::max(e3,e4))) return -33;
+
+    // Indexreduktion: e1 und e2 werden abgeleitet, danach ist alles zugeordnet
+    matchSystem();
+    if (m_equations.size() != n+2) return -34;
+    for (size_t i=0;i<m_equations.size();++i)
+    {
+      if (m_equations[i]->symbol == NULL) return -35;
+      if (m_equations[i]->symbol->eqn != i+1) return -36;
+    }
+    if ((m_equations[e4]->symbol != mp) || (m_equations[e3]->symbol != mq)) return -37;
+    if (ma->eqn == 0) return -38;
+
+    return 0;
+  }
+};
+
 int pendulum( int &argc,  char *argv[])
 {
   // Beispiel aufbauen
@@ -56,7 +155,7 @@ int pendulumDAE( int &argc,  char *argv[])
   // Beispiel aufbauen
   // subs(exp,old,new)
 
-  Graph::Graph gr;
+  BlockGraph gr;
 
   // throw SymbolAlreadyExistsError when adding twice
   SymbolPtr L(new Symbol("L",PARAMETER));
@@ -89,6 +188,156 @@ int pendulumDAE( int &argc,  char *argv[])
 
   gr.buildGraph(true);
 
+  // Bloecke nach der Sortierung
+  Graph::UnMatchedSystem *sys = gr.getUnMatchedSystem();
+  if (sys == NULL) return -7;
+  // x, der(y), der(x), xd und die Schleife der(yd), der(der(y)), der(der(x)), der(xd), F
+  if (sys->getNumBlocks() != 5) return -8;
+  if (sys->getMaxBlockSize() != 5) return -9;
+
+  // Tearing: die algebraische Schleife bleibt mit einem Residuum fuer F
+  Graph::AssignmentsPtr a = gr.getAssignments(DER_STATE);
+  std::vector<Graph::Assignment> eqns = a->getEquations();
+  size_t torn = 0;
+  for (size_t i=0;i<eqns.size();++i)
+  {
+    // einzelne implizite Gleichungen haben nur Residuen
+    if (eqns[i].lhs.size() == eqns[i].residuals) continue;
+    if (eqns[i].residuals == 0) continue;
+    torn++;
+    if (!eqns[i].implizit) return -1;
+    if (eqns[i].residuals != 1) return -2;
+    if (eqns[i].tearing.size() != 1) return -3;
+    if (eqns[i].tearing[0] != F) return -4;
+    if (eqns[i].lhs.size() <= eqns[i].residuals) return -5;
+  }
+  if (torn != 1) return -6;
+
+  return 0;
+}
+
+// PendulumDAE aufbauen, Zustaende und Zuweisungen als Text
+std::string pendulumDAEText()
+{
+  Graph::Graph gr;
+
+  SymbolPtr L(new Symbol("L",PARAMETER));
+  SymbolPtr m(new Symbol("m",PARAMETER));
+  SymbolPtr g(new Symbol("g",PARAMETER));
+  SymbolPtr x(new Symbol("x"));
+  SymbolPtr y(new Symbol("y"));
+  SymbolPtr xd(new Symbol("xd"));
+  SymbolPtr yd(new Symbol("yd"));
+  SymbolPtr F(new Symbol("F"));
+
+  gr.addSymbol(L);
+  gr.addSymbol(m); 
+  gr.addSymbol(g);
+  gr.addSymbol(x,L.get());
+  gr.addSymbol(y);
+  gr.addSymbol(xd);
+  gr.addSymbol(yd);
+  gr.addSymbol(F);
+
+  gr.addExpression(L,Int::New(1));
+  gr.addExpression(m,Int::New(1));
+  gr.addExpression(g,Real::New(9.81));
+
+  gr.addExpression(NULL,Pow::New(x,Int::New(2)) +  Pow::New(y,Int::New(2)) - Pow::New(L,Int::New(2))); 
+  gr.addExpression(NULL,Der::New(x)-xd);  
+  gr.addExpression(NULL,Der::New(y)-yd);  
+  gr.addExpression(NULL,m*Der::New(xd)+Util::div(x*F,L)); 
+  gr.addExpression(NULL,m*Der::New(yd)+m*g+Util::div(F*y,L)); 
+
+  gr.buildGraph(true);
+
+  std::stringstream text;
+  SymbolPtrVec states = gr.getVariables(STATE);
+  for (size_t i=0;i<states.size();++i)
+    text << states[i]->toString() << " ";
+  text << std::endl;
+  std::vector<Graph::Assignment> eqns = gr.getAssignments(DER_STATE)->getEquations();
+  for (size_t i=0;i<eqns.size();++i)
+    for (size_t j=0;j<eqns[i].lhs.size();++j)
+      text << eqns[i].lhs[j]->toString() << " = " << eqns[i].rhs[j]->toString() << std::endl;
+  return text.str();
+}
+
+int repeatedDAE( int &argc,  char *argv[])
+{
+  // die Auswahl der Dummy Zustaende haengt nicht von den Adressen und damit
+  // nicht davon ab, welche Graphen vorher im Prozess aufgebaut wurden
+  std::string first = pendulumDAEText();
+  if (first.compare(0,5,"y yd ") != 0) return -15;
+  for (size_t i=0;i<4;++i)
+  {
+    if (i % 2 == 0)
+    {
+      int res = pendulum(argc,argv);
+      if (res != 0) return res;
+    }
+    if (pendulumDAEText() != first) return -16;
+  }
+  return 0;
+}
+
+int indexReduction( int &argc,  char *argv[])
+{
+  // der(x) = a, b = x, b = c: Index 2, b - x und b - c muessen abgeleitet
+  // werden; p + q = 0, p = c braucht einen augmentierenden Pfad
+  BlockGraph gr;
+
+  SymbolPtr c(new Symbol("c",PARAMETER));
+  SymbolPtr a(new Symbol("a"));
+  SymbolPtr b(new Symbol("b"));
+  SymbolPtr x(new Symbol("x"));
+  SymbolPtr p(new Symbol("p"));
+  SymbolPtr q(new Symbol("q"));
+
+  gr.addSymbol(c);
+  gr.addSymbol(a);
+  gr.addSymbol(b);
+  gr.addSymbol(x);
+  gr.addSymbol(p);
+  gr.addSymbol(q);
+
+  gr.addExpression(c,Int::New(1));
+  gr.addExpression(NULL,Der::New(x)-a);
+  gr.addExpression(NULL,b-x);
+  gr.addExpression(NULL,b-c);
+  gr.addExpression(NULL,p+q);
+  gr.addExpression(NULL,p-c);
+
+  Graph::NodeVec nodes;
+  MatchSystem sys(gr.getEquationSystem(),nodes);
+  return sys.run(a,b,p,q);
+}
+
+int longChain( int &argc,  char *argv[])
+{
+  // x(i) = 2*x(i+1) + 1, x(n-1) = 1: jede Gleichung ist ein eigener Block, die
+  // Tiefensuche laeuft die ganze Kette entlang, Tiefe n
+  const size_t n = 5000;
+  BlockGraph gr;
+  SymbolPtrVec x;
+  for (size_t i=0;i<n;++i)
+  {
+    std::stringstream name;
+    name << "x" << i;
+    x.push_back(new Symbol(name.str()));
+    gr.addSymbol(x[i]);
+  }
+  for (size_t i=0;i+1<n;++i)
+    gr.addExpression(NULL,x[i]-2*x[i+1]-Int::New(1));
+  gr.addExpression(NULL,x[n-1]-Int::New(1));
+
+  gr.buildGraph(false);
+
+  Graph::UnMatchedSystem *sys = gr.getUnMatchedSystem();
+  if (sys == NULL) return -11;
+  if (sys->getNumBlocks() != n) return -12;
+  if (sys->getMaxBlockSize() != 1) return -13;
+
   return 0;
 }
 
@@ -99,5 +348,11 @@ int main( int argc,  char *argv[])
   if (res !=0) return res;
   res = pendulumDAE(argc,argv);
   if (res !=0) return res;
+  res = repeatedDAE(argc,argv);
+  if (res !=0) return res;
+  res = indexReduction(argc,argv);
+  if (res !=0) return res;
+  res = longChain(argc,argv);
+  if (res !=0) return res;
   return 0;
 }
\ No newline at end of file
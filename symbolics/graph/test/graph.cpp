@@ -1,6 +1,7 @@
 #include <iostream>
 #include "Symbolics.h"
 #include "Graph.h"
+#include "MatchedSystem.h"
 
 using namespace Symbolics;
 
@@ -187,6 +188,154 @@ int toGraphML( int &argc,  char *argv[])
 }
 
 
+int arenaMemory( int &argc,  char *argv[])
+{
+    Graph::Graph g;
+    // Symbol time liegt schon in der Arena
+    size_t start = g.getArenaMemory();
+    if (start == 0) return -20;
+    ArenaPtr arena = Arena::getScope();
+    size_t objects = arena->getObjects();
+
+    BasicPtr exp(new Int(0));
+    for (size_t i=0;i<1000;++i)
+    {
+        SymbolPtr s(new Symbol("a"+str(i)));
+        g.addSymbol(s);
+        exp = Add::New(exp,Sin::New(s));
+    }
+    if (arena->getObjects() <= objects) return -21;
+    if (g.getArenaMemory() <= start) return -22;
+    if (arena->getUsed() > arena->getReserved()) return -23;
+
+    // neuer Graph, neue Arena
+    Graph::Graph g2;
+    if (g2.getArenaMemory() >= g.getArenaMemory()) return -24;
+    BasicPtr a(new Symbol("a"));
+    if (Arena::getScope()->getObjects() == 0) return -25;
+    if (Arena::getScope().get() == arena.get()) return -26;
+
+    return 0;
+}
+
+// Zugriff auf Knoten und Systemhandler fuer die Sortiertests
+class SortGraph: public Graph::Graph
+{
+public:
+    Symbolics::Graph::NodeVec& getNodes() { return m_nodes; };
+    Symbolics::Graph::MatchedSystem* getMatched() { return dynamic_cast<Symbolics::Graph::MatchedSystem*>(m_syshandler.get()); };
+};
+
+// prueft, ob nodes[i] nach symbols[i] aufloest
+bool sameOrder(Graph::NodeVec& nodes, std::vector<SymbolPtr> const& symbols)
+{
+    if (nodes.size() != symbols.size()) return false;
+    for (size_t i=0;i<nodes.size();++i)
+    {
+        if (nodes[i]->getSolveFor().size() != 1) return false;
+        if (nodes[i]->getSolveFor().begin()->first != symbols[i]) return false;
+    }
+    return true;
+}
+
+int sortEquations( int &argc,  char *argv[])
+{
+    // Kette f -> h -> g -> i -> j, Gleichungen in umgekehrter Reihenfolge
+    SortGraph gr;
+    SymbolPtr f(new Symbol("f",PARAMETER));
+    SymbolPtr h(new Symbol("h"));
+    SymbolPtr g(new Symbol("g"));
+    SymbolPtr i(new Symbol("i"));
+    SymbolPtr j(new Symbol("j"));
+    gr.addSymbol(f);
+    gr.addSymbol(h);
+    gr.addSymbol(g);
+    gr.addSymbol(i);
+    gr.addSymbol(j);
+
+    gr.addExpression(j,Add::New(i,g),false);
+    gr.addExpression(i,Mul::New(g,h),false);
+    gr.addExpression(g,Mul::New(Int::New(2),h),false);
+    gr.addExpression(h,f,false);
+    BasicPtr exp_f(new Real(1.0));
+    gr.addExpression(f,exp_f,false);
+
+    gr.buildGraph(false);
+    if (gr.getMatched() == NULL) return -30;
+    gr.getMatched()->sortEquations();
+
+    std::vector<SymbolPtr> order;
+    order.push_back(f);
+    order.push_back(h);
+    order.push_back(g);
+    order.push_back(i);
+    order.push_back(j);
+    if (!sameOrder(gr.getNodes(),order)) return -31;
+
+    // nochmal sortieren aendert nichts
+    gr.getMatched()->sortEquations();
+    if (!sameOrder(gr.getNodes(),order)) return -32;
+
+    // Elternknoten fehlt im NodeGraph
+    Graph::NodeVec partial;
+    partial.push_back(gr.getNodes()[1]);
+    try
+    {
+        Graph::NodeGraph ng(partial);
+        return -33;
+    }
+    catch(InternalError)
+    {
+
+    }
+    catch(...)
+    {
+        return -34;
+    }
+
+    return 0;
+}
+
+int deepChain( int &argc,  char *argv[])
+{
+    // a0 -> a1 -> ... -> a(n-1), Gleichungen vom Ende her angelegt, damit
+    // die Tiefensuche vom ersten Knoten aus die ganze Kette durchlaeuft
+    size_t n = 5000;
+    SortGraph gr;
+    std::vector<SymbolPtr> symbols;
+    SymbolPtr a0(new Symbol("a0",PARAMETER));
+    symbols.push_back(a0);
+    gr.addSymbol(a0);
+    for (size_t i=1;i<n;++i)
+    {
+        SymbolPtr s(new Symbol("a"+str(i)));
+        symbols.push_back(s);
+        gr.addSymbol(s);
+    }
+    for (size_t i=n-1;i>0;--i)
+    {
+        BasicPtr exp(symbols[i-1]);
+        gr.addExpression(symbols[i],exp,false);
+    }
+    BasicPtr exp_a0(new Real(1.0));
+    gr.addExpression(a0,exp_a0,false);
+
+    gr.buildGraph(false);
+    if (gr.getMatched() == NULL) return -40;
+
+    Graph::ConstAssignmentsPtr a = gr.getAssignments(Symbolics::VARIABLE,Symbolics::PARAMETER);
+    Graph::VariableVec vars = a->getVariables(Symbolics::VARIABLE);
+    if (vars.size() != n-1) return -41;
+    for (size_t i=0;i<vars.size();++i)
+        if (vars[i] != symbols[i+1]) return -42;
+
+    gr.getMatched()->sortEquations();
+    if (!sameOrder(gr.getNodes(),symbols)) return -43;
+
+    return 0;
+}
+
+
 int LinearModel( int &argc,  char *argv[])
 {
     // Beispiel aufbauen
@@ -308,6 +457,12 @@ int main( int argc,  char *argv[])
         if (res !=0) return res;
         res = toGraphML(argc,argv);
         if (res !=0) return res;
+        res = arenaMemory(argc,argv);
+        if (res !=0) return res;
+        res = sortEquations(argc,argv);
+        if (res !=0) return res;
+        res = deepChain(argc,argv);
+        if (res !=0) return res;
     }
     if(!t)
     {
@@ -0,0 +1,88 @@
+#ifndef __ARENA_H_
+#define __ARENA_H_
+
+#include <cstddef>
+#include <vector>
+#include "intrusive_ptr.h"
+
+// Forward Declarations
+namespace Symbolics
+{
+    class Arena;
+};
+
+namespace Symbolics
+{
+    void intrusive_ptr_add_ref( const Symbolics::Arena *p);
+    void intrusive_ptr_release( const Symbolics::Arena *p);
+};
+
+namespace Symbolics
+{
+/*****************************************************************************/
+    typedef boost::intrusive_ptr<Arena> ArenaPtr;
+/*****************************************************************************/
+
+/*****************************************************************************/
+    // Speicher fuer Basic, Equation und Node eines Scopes (je Graph).
+    // Objekte werden aus grossen Bloecken geholt, freigegebener Speicher kommt in
+    // eine Freiliste je Groesse. Die Bloecke werden erst zusammen freigegeben, wenn
+    // der Scope und alle Objekte darin weg sind (jedes Objekt haelt eine Referenz).
+    class Arena
+    {
+    public:
+        // Konstruktor
+        Arena();
+        // Destruktor
+        ~Arena();
+
+        // fuer operator new / delete der Klassen, aus dem aktuellen Scope
+        static void* allocate( size_t size );
+        static void deallocate( void *p, size_t size );
+
+        // neuer Scope (wird von Util::newScope, also je Graph, aufgerufen)
+        static void newScope();
+        static ArenaPtr getScope();
+
+        // Speicher in Bloecken (Bytes)
+        inline size_t getReserved() const { return m_reserved; };
+        // Speicher in lebenden Objekten (Bytes)
+        inline size_t getUsed() const { return m_used; };
+        // Anzahl lebender Objekte
+        inline size_t getObjects() const { return m_objects; };
+
+    private:
+        struct Block
+        {
+            Arena *arena;
+            Block *next;
+        };
+
+        void* alloc( size_t size );
+        void free( void *p, size_t size );
+        Block* newBlock( size_t size );
+
+        static Arena*& scope();
+
+        // Bloecke
+        Block *m_blocks;
+        char *m_pos;
+        char *m_end;
+        // Freilisten je Groessenklasse
+        std::vector<void*> m_free;
+
+        // Zaehler
+        size_t m_reserved;
+        size_t m_used;
+        size_t m_objects;
+
+        // Boost Intrusive Ptr
+        unsigned int m_refCount;
+        // friend
+        friend void intrusive_ptr_add_ref( const Arena* p);
+        friend void intrusive_ptr_release( const Arena* p);
+    };
+/*****************************************************************************/
+};
+
+#endif // __ARENA_H_
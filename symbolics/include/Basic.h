@@ -5,22 +5,31 @@
 #include <string>
 #include <set>
 #include <map>
+#include <unordered_map>
+#include <utility>
 #include "Shape.h"
 #include <cassert>
 
 #include "intrusive_ptr.h"
+#include "Arena.h"
 
 // Forward Declarations
 namespace Symbolics
 {
     class Basic;
     class Argument;
+    class InternScope;
+    class AtomList;
 };
 
-namespace boost
+namespace Symbolics
 {
     void intrusive_ptr_add_ref( const Symbolics::Basic *p);
     void intrusive_ptr_release( const Symbolics::Basic *p);
+    void intrusive_ptr_add_ref( const Symbolics::InternScope *p);
+    void intrusive_ptr_release( const Symbolics::InternScope *p);
+    void intrusive_ptr_add_ref( const Symbolics::AtomList *p);
+    void intrusive_ptr_release( const Symbolics::AtomList *p);
 };
 
 // Declarations
@@ -35,6 +44,38 @@ namespace Symbolics
     typedef std::vector<Argument> ArgumentPtrVec;
 
     typedef std::map<BasicPtr, BasicPtr> BasicPtrMap;
+
+    typedef boost::intrusive_ptr<InternScope> InternScopePtr;
+    typedef boost::intrusive_ptr<AtomList> AtomListPtr;
+    /*****************************************************************************/
+
+    /*****************************************************************************/
+    // Atome (Symbole) eines Ausdrucks, nach Adresse sortiert und ohne Doppelte.
+    // Wird je Knoten einmal berechnet und zwischen Knoten geteilt (z.B. Neg(x) und x)
+    class AtomList
+    {
+    public:
+        AtomList(): mask(0), m_refCount(0) {;};
+        ~AtomList() {;};
+
+        typedef std::vector<Basic const*> SymbolVec;
+        SymbolVec symbols;
+
+        // Bloom-Maske: ein Bit je Symbol (nach Hash des Namens)
+        size_t mask;
+
+        inline bool empty() const { return symbols.empty(); };
+        inline size_t size() const { return symbols.size(); };
+        // binaere Suche nach der Adresse
+        bool contains( Basic const* symbol ) const;
+
+    private:
+        // Boost Intrusive Ptr
+        unsigned int m_refCount;
+        // friend
+        friend void intrusive_ptr_add_ref( const AtomList* p);
+        friend void intrusive_ptr_release( const AtomList* p);
+    };
     /*****************************************************************************/
 
 
@@ -85,9 +126,15 @@ namespace Symbolics
         // Konstruktor
         Basic( Basic_Type const& type );
         Basic( Basic_Type const& type, Shape const& shape );
+        // Kopie: Eltern, Referenzzaehler und Hash-Consing werden nicht uebernommen
+        Basic( Basic const& src );
         // Destruktor
         virtual ~Basic();
 
+        // Speicher aus der Arena des aktuellen Scopes
+        static inline void* operator new( size_t size ) { return Arena::allocate(size); };
+        static inline void operator delete( void *p, size_t size ) { Arena::deallocate(p,size); };
+
         // Getter: Name
         inline Basic_Type const& getType() const { return m_type; };
 
@@ -103,6 +150,9 @@ namespace Symbolics
 
         // Vereinfachen, wenn unver�ndert, dann NULL
         virtual BasicPtr simplify()  = 0;
+        // simplify ueber den Cache des Scopes, strukturell gleiche Ausdruecke
+        // werden so nur einmal vereinfacht
+        BasicPtr simplifyCached();
 
         // Vergleich
         virtual bool operator==(  Basic const& rhs ) const  = 0;
@@ -112,11 +162,19 @@ namespace Symbolics
         // Ersetzen
         virtual BasicPtr subs( ConstBasicPtr const& old_exp,  BasicPtr const& new_exp);
         void subs( BasicPtr const& new_exp);
+        // alle Ersetzungen der Map in einem Durchlauf, Schluessel werden strukturell verglichen (operator< der Map)
+        BasicPtr subs( BasicPtrMap const& repl );
 
         // atoms
         typedef std::set< BasicPtr > BasicSet;
+        // aus getAtomList, kostet nur noch die Anzahl der Atome
         BasicSet getAtoms();
         virtual void getAtoms(BasicSet &atoms)  = 0;
+        // zwischengespeichert, wird bei Aenderung der Argumente verworfen
+        AtomListPtr const& getAtomList() const;
+        inline bool hasAtoms() const { return !getAtomList()->empty(); };
+        // false, wenn exp sicher nicht im Ausdruck vorkommt (Symbole fehlen)
+        inline bool mayContain( Basic const* exp ) const { size_t m = exp->getAtomList()->mask; return (getAtomList()->mask & m) == m; };
 
         typedef std::map< BasicPtr, size_t > BasicSizeTMap;
         BasicSizeTMap getAtomsAmound();
@@ -133,14 +191,50 @@ namespace Symbolics
 
         BasicPtr solve(BasicPtr exp);
 
-        // hash
-        virtual inline size_t getHash() const { return m_hash; };
+        // hash: strukturell gleiche Ausdruecke haben den gleichen Hash, wird beim
+        // ersten Zugriff berechnet und bei Aenderung der Argumente verworfen
+        inline size_t getHash() const { if (!m_hashValid) { m_hash = calcHash(); m_hashValid = true; } return m_hash; };
+
+        // Ergebnis je besuchtem Knoten fuer einen Durchlauf (iterateExp, subs),
+        // geteilte Teilausdruecke werden so nur einmal bearbeitet und bleiben geteilt
+        class Memo
+        {
+        public:
+            Memo(): m_enabled(true), m_depth(0) {;}
+
+            // NULL wenn der Knoten in diesem Durchlauf noch nicht bearbeitet wurde
+            inline BasicPtr find( Basic const* basic ) const;
+            inline BasicPtr const& insert( Basic const* basic, BasicPtr const& result );
+
+            inline void setEnabled( bool on ) { m_enabled = on; m_map.clear(); };
+            inline bool getEnabled() const { return m_enabled; };
+
+            // haelt den Durchlauf offen, der aeusserste leert das Memo wieder
+            class Pass
+            {
+            public:
+                Pass( Memo &memo ): m_memo(memo) { ++m_memo.m_depth; }
+                ~Pass() { if (--m_memo.m_depth == 0) m_memo.m_map.clear(); }
+            private:
+                Pass( Pass const& );
+                Pass& operator=( Pass const& );
+                Memo &m_memo;
+            };
+
+        private:
+            typedef std::unordered_map<Basic const*, BasicPtr> MemoMap;
+            MemoMap m_map;
+            bool m_enabled;
+            size_t m_depth;
+        };
 
         // iterate through the expression
+        // process_Arg muss nur vom Knoten abhaengen, sonst memo.setEnabled(false)
         class Iterator
         {
         public:
           virtual BasicPtr process_Arg(BasicPtr const &p) = 0;
+          Memo memo;
         };
         virtual  BasicPtr iterateExp(Iterator &v);
 
@@ -152,25 +246,37 @@ namespace Symbolics
         // stops if Scanner return false, itterates the expression top-down
         virtual void scanExp(Scanner &s);
 
+        // Durchlauf ueber einen eigenen Stack statt Rekursion, ohne Refcount
+        class Walker
+        {
+        public:
+            virtual ~Walker() {;}
+            // pre-order, false: Argumente nicht besuchen, stop: Durchlauf abbrechen
+            virtual bool enter(Basic const* p, bool &stop) = 0;
+            // post-order, nur wenn enter true geliefert hat
+            virtual void leave(Basic const*, bool &) {;}
+        };
+        void walkExp(Walker &w) const;
+
   		// Parent
         // Wir halten hier direkt den Pointer, damit der Refcount nicht erhoeht wird und sich keine zirkulaeren Bezuege ergeben
-		    inline void addParent( ArgumentPtr parent ) { m_parents.insert( parent ); };
-		    inline void removeParent( ArgumentPtr parent ) 
-		    { 
-			    if(m_parents.erase( parent ) != 1) 
-				    throw InternalError("Hier ist was faul mit Papi");
-		    };
-		    inline void clearParents() { m_parents.clear(); };
-		    typedef std::set<ArgumentPtr> ArgumentPtrSet;
-		    inline ArgumentPtrSet& getParents() { return m_parents; };
-        inline size_t getParentsSize() const { return m_parents.size(); };
-
-        class LookFor: public Scanner
+        // Die Parents bilden eine doppelt verkettete Liste ueber die Argumente selbst,
+        // so kostet jede Kante weder Allokation noch Suche
+		    inline void addParent( ArgumentPtr parent );
+		    inline void removeParent( ArgumentPtr parent );
+		    inline void clearParents();
+		    typedef std::vector<ArgumentPtr> ArgumentPtrList;
+		    // Kopie der Parents, bleibt gueltig wenn sich die Parents aendern
+		    ArgumentPtrList getParents() const;
+		    inline ArgumentPtr getFirstParent() const { return m_firstParent; };
+        inline size_t getParentsSize() const { return m_parentsSize; };
+
+        class LookFor: public Walker
         {
         public:
             LookFor(BasicPtr const &lookfor) :m_lookfor(lookfor),found(false) {;}
             ~LookFor() {;}
-            bool process_Arg(BasicPtr const &p, bool &stop);
+            bool enter(Basic const* p, bool &stop);
             bool found;
         protected:
             BasicPtr m_lookfor;
@@ -181,24 +287,51 @@ namespace Symbolics
         Basic_Type m_type;
         // Shape
         Shape m_shape;
-        // simplifed Flag
-        bool m_simplified;
+        // simplifed: Epoche, in der der Knoten zuletzt vereinfacht wurde, und Epoche
+        // der letzten Ersetzung darunter (subs(new_exp) setzt sie nur bei den
+        // Vorfahren der ersetzten Stelle), vereinfacht solange nichts Neueres
+        size_t m_simplifiedEpoch;
+        size_t m_changedEpoch;
+        static size_t m_epoch;
+        inline bool is_Simplified() const { return (m_simplifiedEpoch != 0) && (m_simplifiedEpoch >= m_changedEpoch); };
+        inline void setSimplified( bool simplified ) { m_simplifiedEpoch = simplified ? m_epoch : 0; };
+        // nodes und alle Vorfahren als geaendert markieren, ohne Rekursion
+        static void changed( std::vector<Basic*> &nodes );
         // hash
-        size_t m_hash;
+        mutable size_t m_hash;
+        mutable bool m_hashValid;
 
-        virtual void calcHash();
+        // Atome
+        mutable AtomListPtr m_atoms;
+        class AtomWalker;
+
+        virtual size_t calcHash() const;
+        // Hash und Atome ungueltig machen, laeuft (ohne Rekursion) bis zum ersten
+        // Parent hoch, bei dem beides schon ungueltig ist
+        void hashChanged();
+
+        // Hilfsfunktionen fuer calcHash
+        static size_t hashCombine( size_t seed, size_t hash );
+        static size_t hashMix( size_t hash );
+        // Zahlen (Int, Real, Zero, Bool) nach Wert, damit 2 == 2.0 den gleichen Hash hat
+        static size_t hashNumber( double value );
 
 		    // Referenz auf Parent, Referenz damit RefCount nicht veraendert wird und sich damit keine zirulaere Referenz ergibt
-		    ArgumentPtrSet m_parents;
+		    ArgumentPtr m_firstParent;
+		    size_t m_parentsSize;
 
-        void changed();
+        // Memo fuer subs, ein Durchlauf je aeusserstem Aufruf
+        static Memo& subsMemo();
+        // gleicher Typ mit neuen Argumenten, fuer subs mit Map
+        virtual BasicPtr newWithArgs( BasicPtrVec &args ) const;
+        class MapSubs;
 
-        class LookForMultiple: public Scanner
+        class LookForMultiple: public Walker
         {
         public:
             LookForMultiple(BasicSet &lookfor) :m_lookfor(lookfor),found(false) {;}
             ~LookForMultiple() {;}
-            bool process_Arg(BasicPtr const &p, bool &stop);
+            bool enter(Basic const* p, bool &stop);
             bool found;
         protected:
             BasicSet &m_lookfor;
@@ -206,9 +339,16 @@ namespace Symbolics
     private:
         // Boost Intrusive Ptr
         unsigned int m_refCount;
+        // Hash-Consing: Tabelle, in der der Knoten eingetragen ist (NULL wenn nicht geteilt)
+        InternScopePtr m_internScope;
+        size_t m_internKey;
+        // Loeschen ohne Rekursion ueber die Argumente (tiefe Ketten)
+        static void destroy( Basic *b );
         // friend
-        friend void ::boost::intrusive_ptr_add_ref( const Basic* p);
-        friend void ::boost::intrusive_ptr_release( const Basic* p);
+        friend void intrusive_ptr_add_ref( const Basic* p);
+        friend void intrusive_ptr_release( const Basic* p);
+        friend class Factory;
+        friend class Argument;
     };
     /*****************************************************************************/
 
@@ -217,35 +357,110 @@ namespace Symbolics
       {
       public:
         // Konstruktor
-        Argument(): m_parent(0)  {;}
-        Argument(Basic* parent): m_parent(0) { if(parent) m_parent = parent;}
-        Argument(Basic* parent, BasicPtr arg): m_parent(0) { if(parent) m_parent = parent; setArg(arg); }
-        Argument(BasicPtr arg): m_parent(0) { setArg(arg); }
-        Argument(const Argument& a): m_parent(0)
+        Argument(): m_parent(0), m_prevParent(0), m_nextParent(0)  {;}
+        Argument(Basic* parent): m_parent(0), m_prevParent(0), m_nextParent(0) { if(parent) m_parent = parent;}
+        Argument(Basic* parent, BasicPtr arg): m_parent(0), m_prevParent(0), m_nextParent(0) { if(parent) m_parent = parent; setArg(std::move(arg)); }
+        Argument(BasicPtr arg): m_parent(0), m_prevParent(0), m_nextParent(0) { setArg(std::move(arg)); }
+        Argument(const Argument& a): m_parent(0), m_prevParent(0), m_nextParent(0)
         {
           setArg(a.m_arg);
           registerParent(a.m_parent);
         };
+        // Zuweisung: die Verkettung in der Parentliste des Arguments bleibt bei diesem Objekt
+        Argument& operator=(const Argument& a)
+        {
+          if (this != &a)
+          {
+            registerParent(a.m_parent);
+            if (a.m_arg.get() != NULL)
+              setArg(a.m_arg);
+          }
+          return *this;
+        };
         // Destruktor
         ~Argument() { unregisterParent(); }
         // Argument
-        inline void setArg(BasicPtr const& arg) { if (m_arg.get() != NULL) m_arg->removeParent(this); m_arg = arg; m_arg->addParent(this); }
+        inline void setArg(BasicPtr const& arg) { if (m_arg.get() != NULL) m_arg->removeParent(this); m_arg = arg; m_arg->addParent(this); if (m_parent) m_parent->hashChanged(); }
+        // temporaere Ausdruecke uebernehmen, ohne RefCount hoch und wieder runter
+        inline void setArg(BasicPtr && arg) { if (m_arg.get() != NULL) m_arg->removeParent(this); m_arg = std::move(arg); m_arg->addParent(this); if (m_parent) m_parent->hashChanged(); }
         inline BasicPtr const& getArg() const { return m_arg; }
         // Parent
         inline void registerParent( Basic* parent ) { if(parent) m_parent = parent; }
         inline void unregisterParent() { m_parent=0; if (m_arg.get() != NULL) m_arg->removeParent(this); m_arg=NULL; }
         inline BasicPtr getParent() const { return BasicPtr(m_parent); };
+        inline Basic* getParentPtr() const { return m_parent; };
+        // naechster Eintrag in der Parentliste von getArg()
+        inline Argument* getNextParent() const { return m_nextParent; };
       protected:
         // Argument
         BasicPtr m_arg;
         // Parent
         Basic* m_parent;
+        // Verkettung in der Parentliste von m_arg
+        Argument* m_prevParent;
+        Argument* m_nextParent;
+
+        friend class Basic;
       };
+
+    /*****************************************************************************/
+    inline void Basic::addParent( ArgumentPtr parent )
+    {
+        parent->m_prevParent = NULL;
+        parent->m_nextParent = m_firstParent;
+        if (m_firstParent != NULL)
+            m_firstParent->m_prevParent = parent;
+        m_firstParent = parent;
+        ++m_parentsSize;
+    }
+
+    inline void Basic::removeParent( ArgumentPtr parent )
+    {
+        // nur verkettete Argumente oder der Kopf der Liste
+        if ((parent->m_prevParent == NULL) && (m_firstParent != parent))
+            throw InternalError("Hier ist was faul mit Papi");
+        if (parent->m_prevParent != NULL)
+            parent->m_prevParent->m_nextParent = parent->m_nextParent;
+        else
+            m_firstParent = parent->m_nextParent;
+        if (parent->m_nextParent != NULL)
+            parent->m_nextParent->m_prevParent = parent->m_prevParent;
+        parent->m_prevParent = NULL;
+        parent->m_nextParent = NULL;
+        --m_parentsSize;
+    }
+
+    inline void Basic::clearParents()
+    {
+        while (m_firstParent != NULL)
+            removeParent(m_firstParent);
+    }
+    /*****************************************************************************/
+
+    /*****************************************************************************/
+    inline BasicPtr Basic::Memo::find( Basic const* basic ) const
+    {
+        if (!m_enabled || m_map.empty())
+            return BasicPtr();
+        MemoMap::const_iterator ii = m_map.find(basic);
+        if (ii == m_map.end())
+            return BasicPtr();
+        return ii->second;
+    }
+    /*****************************************************************************/
+
+    /*****************************************************************************/
+    inline BasicPtr const& Basic::Memo::insert( Basic const* basic, BasicPtr const& result )
+    {
+        if (m_enabled && (m_depth > 0))
+            m_map[basic] = result;
+        return result;
+    }
     /*****************************************************************************/
 };
 
 /*****************************************************************************/
-namespace boost
+namespace Symbolics
 {
     // increment reference count of object *p
     inline void intrusive_ptr_add_ref( const Symbolics::Basic* p)
@@ -261,10 +476,10 @@ namespace boost
         // Muss sein, da ich sonst keine  Basics in intrusive Ptr legen kann
         Symbolics::Basic* b = const_cast<Symbolics::Basic*>(p);
         if (--(b->m_refCount) == 0)
-            delete p;
+            Symbolics::Basic::destroy(b);
     } 
 
-}; // namespace boost
+}; // namespace Symbolics
 /*****************************************************************************/
 
 // Damit alle die Basic inkludieren, auch die Operatoren dazu kennen
@@ -10,6 +10,9 @@ namespace Symbolics
     class BinaryOp: public Basic
     {
     public:
+        // Typpruefung fuer Util::getAsConstPtr
+        static inline bool is_Type( Basic const* b ) { return dynamic_cast<BinaryOp const*>(b) != NULL; };
+
         // Konstruktor
         BinaryOp(  Basic_Type type,  BasicPtrVec const& args );
         // Konstruktor
@@ -49,7 +52,7 @@ namespace Symbolics
     protected:
         inline void setArg1( BasicPtr const& arg) { m_arg1.setArg(arg); };
         inline void setArg2( BasicPtr const& arg) { m_arg2.setArg(arg); };
-        inline void simplifyArgs() { setArg1(getArg1()->simplify()); setArg2(getArg2()->simplify()); };
+        inline void simplifyArgs() { setArg1(getArg1()->simplifyCached()); setArg2(getArg2()->simplifyCached()); };
 
     private:
         // Arguments
@@ -16,6 +16,9 @@ namespace Symbolics
     class Bool: public Basic
     {
     public:
+        // Typpruefung fuer Util::getAsConstPtr
+        static inline bool is_Type( Basic const* b ) { return b->getType() == Type_Bool; };
+
         // Konstruktor
         Bool(  const bool value );
         ~Bool();
@@ -55,6 +58,9 @@ namespace Symbolics
     protected:
          bool m_value;
 
+         // hash nach Wert, false wie Zero
+         inline size_t calcHash() const { return hashNumber(m_value?1:0); };
+
          static BasicPtr getArgres;
     };
 
@@ -11,6 +11,9 @@ namespace Symbolics
     class Eye: public Basic
     {
     public:
+        // Typpruefung fuer Util::getAsConstPtr
+        static inline bool is_Type( Basic const* b ) { return b->getType() == Type_Eye; };
+
         Eye();
         Eye(Shape const& s);
 
@@ -44,12 +47,16 @@ namespace Symbolics
     
         inline static BasicPtr & getEye() { return eye; };
         static BasicPtr getEye(Shape const& s);
+        // Pool leeren, die Knoten liegen in der Arena des Scopes (Util::newScope)
+        static void newScope();
 
         // derivative
         inline BasicPtr der() { return Zero::getZero(m_shape); };
         inline BasicPtr der(BasicPtr const& symbol) { return Zero::getZero(m_shape); };
     protected:
         static BasicPtr eye;
+        // geteilte Einheitsmatrizen je Shape
+        static BasicPtr const& getPooled(Shape const& s);
 
         static BasicPtr getArgres;
 
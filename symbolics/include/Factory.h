@@ -1,11 +1,70 @@
 #ifndef __FACTORY_H_
 #define __FACTORY_H_
 
+#include <unordered_map>
 #include "Symbolics.h"
 
 // Declarations
 namespace Symbolics
 {
+    /*****************************************************************************/
+    // Hash-Consing Tabelle eines Scopes: enthaelt alle lebenden Knoten, die ueber
+    // die Factory bzw. die New-Funktionen erzeugt wurden. Die Knoten tragen sich
+    // im Destruktor selbst wieder aus, die Tabelle haelt also keine Referenz.
+    class InternScope
+    {
+    public:
+        // Konstruktor
+        InternScope(): m_simplifyHits(0), m_simplifyMisses(0), m_refCount(0) {;};
+        ~InternScope() {;};
+
+        // lebenden Knoten mit gleichem Typ, Shape und gleichen Argumenten suchen
+        Basic* find( size_t key, Basic const* basic ) const;
+        void insert( size_t key, Basic *basic );
+        void remove( size_t key, Basic const* basic );
+
+        // Anzahl der geteilten Knoten
+        inline size_t size() const { return m_table.size(); };
+
+        // Cache fuer simplify: Ergebnis je Knoten mit gleichem Typ, Shape und
+        // strukturell gleichen Argumenten (Zustand vor dem Vereinfachen),
+        // key ist der strukturelle Hash vor dem Vereinfachen
+        BasicPtr findSimplified( size_t key, Basic const* basic );
+        void insertSimplified( size_t key, Basic_Type type, Shape const& shape, BasicPtrVec const& args, BasicPtr const& result );
+        // die Eintraege halten Argumente und Ergebnis fest, daher ist der Cache
+        // begrenzt: ist er voll, wird er geleert (0 schaltet ihn ab)
+        static void setSimplifySize( const size_t size );
+
+        // Zaehler fuer den simplify Cache
+        inline size_t getSimplifyHits() const { return m_simplifyHits; };
+        inline size_t getSimplifyMisses() const { return m_simplifyMisses; };
+        inline size_t getSimplifySize() const { return m_simplifyTable.size(); };
+
+    private:
+        typedef std::unordered_multimap<size_t, Basic*> InternTable;
+        InternTable m_table;
+
+        struct SimplifyEntry
+        {
+            Basic_Type type;
+            Shape shape;
+            BasicPtrVec args;
+            BasicPtr result;
+        };
+        typedef std::unordered_multimap<size_t, SimplifyEntry> SimplifyTable;
+        SimplifyTable m_simplifyTable;
+        static size_t m_simplifyMaxSize;
+        size_t m_simplifyHits;
+        size_t m_simplifyMisses;
+
+        // Boost Intrusive Ptr
+        unsigned int m_refCount;
+        // friend
+        friend void intrusive_ptr_add_ref( const InternScope* p);
+        friend void intrusive_ptr_release( const InternScope* p);
+    };
+    /*****************************************************************************/
+
     /*****************************************************************************/
     class Factory
     {
@@ -14,10 +73,31 @@ namespace Symbolics
         ~Factory();
 
     public:
+        // keine && Varianten, siehe Operators.h
         static BasicPtr newBasic( Basic_Type type,  BasicPtr &arg, Shape const& shape );
         static BasicPtr newBasic( Basic_Type type,  BasicPtr &arg1, BasicPtr &arg2, Shape const& shape );
         static BasicPtr newBasic( Basic_Type type,  BasicPtrVec &args, Shape const& shape );
+
+        // Hash-Consing: gibt einen bereits lebenden, strukturell gleichen Knoten
+        // zurueck, sonst wird basic selbst in die Tabelle des Scopes eingetragen
+        static BasicPtr unique( BasicPtr const& basic );
+
+        // neue Tabelle (wird von Util::newScope, also je Graph, aufgerufen)
+        static inline void newScope() { m_scope = InternScopePtr(new InternScope()); };
+        static inline InternScopePtr getScope() { return m_scope; };
+
+        // Hash-Consing an- bzw. ausschalten (Standard: an)
+        static inline void setInterning( bool on ) { m_interning = on; };
+        static inline bool getInterning() { return m_interning; };
+
+    private:
+        static size_t internKey( Basic const* basic );
+
+        static InternScopePtr m_scope;
+        static bool m_interning;
+
+        friend class InternScope;
     };
     /*****************************************************************************/
 };
-#endif // __FACTORY_H_
\ No newline at end of file
+#endif // __FACTORY_H_
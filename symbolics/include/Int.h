@@ -18,11 +18,18 @@ namespace Symbolics
     class Int: public Basic
     {
     public:
+        // Typpruefung fuer Util::getAsConstPtr
+        static inline bool is_Type( Basic const* b ) { return b->getType() == Type_Int; };
+
         // Konstruktor
         Int(  const int value );
         ~Int();
 
         static BasicPtr New( const int i);
+        // Pool: Werte in [min,max] werden nur einmal angelegt
+        static void setPoolRange( const int min, const int max );
+        // Pool leeren, die Knoten liegen in der Arena des Scopes (Util::newScope)
+        static void newScope();
 
         inline int getValue() const  { return m_value; };
 
@@ -75,8 +82,13 @@ namespace Symbolics
     protected:
         int m_value;
 
+        // hash nach Wert, wie Real
+        inline size_t calcHash() const { return hashNumber(m_value); };
+
         static BasicPtr one;
         static BasicPtr minusOne;
+        static int m_poolMin;
+        static int m_poolMax;
 
         static BasicPtr getArgres;
     };
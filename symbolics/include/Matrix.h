@@ -14,6 +14,9 @@ namespace Symbolics
     class Matrix: public NaryOp
     {
     public:
+        // Typpruefung fuer Util::getAsConstPtr
+        static inline bool is_Type( Basic const* b ) { return b->getType() == Type_Matrix; };
+
         // Konstruktor (mit Nullen f�llen)
         Matrix(  Shape const& shape, bool fillZeros = true );
         // Konstruktor (mit Array)
@@ -109,14 +112,14 @@ namespace Symbolics
         template< typename F >
         BasicPtr applyFunctor( F &f ) const
         {
-            // neue Matrix anlegen
-            Matrix* mat = new Matrix(getShape());
+            // neue Matrix gleicher Art anlegen
+            Matrix* mat = newMatrix();
 
             // mit Elementen fuellen
             for(size_t i=0; i<getNumEl(); ++i)
                 mat->set(i, f( getArg(i) ));
 
-            mat->m_simplified=true;
+            mat->setSimplified(true);
             // fertig
             return BasicPtr(mat);
         };
@@ -154,6 +157,12 @@ namespace Symbolics
         
     protected:
         virtual inline size_t getIndex(size_t row, size_t col) const { return row*m_shape.getDimension(2) + col; };
+
+        // leere Matrix gleicher Art und Groesse, SymmetricMatrix bleibt gepackt
+        virtual inline Matrix* newMatrix() const { return new Matrix(m_shape); };
+
+        // hash ueber alle Elemente
+        size_t calcHash() const;
         
         inline void changeShape( Shape const& newShape, bool fillZeros=true )
         {
@@ -3,13 +3,56 @@
 
 #include "Basic.h"
 #include <vector>
+#include <new>
 
 namespace Symbolics
 {
+    /*****************************************************************************/
+    // Argumente eines NaryOp: die ersten INLINE liegen direkt im Knoten, erst
+    // groessere Summen und Matrizen legen ihre Argumente auf den Heap
+    class ArgumentSmallVec
+    {
+    public:
+        enum { INLINE = 3 };
+
+        ArgumentSmallVec(): m_data(inlineData()), m_size(0), m_capacity(INLINE) {;}
+        ~ArgumentSmallVec() { clear(); if (m_data != inlineData()) ::operator delete(m_data); }
+
+        inline size_t size() const { return m_size; };
+        inline Argument& operator[](size_t i) { return m_data[i]; };
+        inline Argument const& operator[](size_t i) const { return m_data[i]; };
+
+        inline void clear() { while (m_size > 0) m_data[--m_size].~Argument(); };
+        void reserve( size_t n );
+        // Argument direkt an seinem Platz anlegen
+        inline void push_back( Basic *parent, BasicPtr const& arg )
+        {
+            if (m_size == m_capacity)
+                reserve(2*m_capacity);
+            new (m_data + m_size) Argument(parent, arg);
+            ++m_size;
+        };
+
+    private:
+        // nicht kopierbar, die Argumente sind in den Parentlisten verkettet
+        ArgumentSmallVec( ArgumentSmallVec const& );
+        ArgumentSmallVec& operator=( ArgumentSmallVec const& );
+
+        inline Argument* inlineData() { return reinterpret_cast<Argument*>(m_inline); };
+
+        Argument *m_data;
+        size_t m_size;
+        size_t m_capacity;
+        alignas(Argument) unsigned char m_inline[INLINE*sizeof(Argument)];
+    };
+    /*****************************************************************************/
 
     class NaryOp: public Basic
     {
     public:
+        // Typpruefung fuer Util::getAsConstPtr
+        static inline bool is_Type( Basic const* b ) { return dynamic_cast<NaryOp const*>(b) != NULL; };
+
         // Konstruktor
         NaryOp( Basic_Type type, BasicPtrVec const& args );
 		    NaryOp( Basic_Type type, BasicPtr const& arg1, BasicPtr const& arg2 );
@@ -40,14 +83,14 @@ namespace Symbolics
                            std::string const& negSep) const;
 
         inline void setArg(size_t i, BasicPtr const& arg) { m_args[i].setArg(arg); };
-        inline void clearArgs() {	m_args.clear(); };
+        inline void clearArgs() {	m_args.clear(); hashChanged(); };
         inline void reserveArgs(size_t n) { m_args.reserve(n); };
-        inline void addArg( BasicPtr const& arg ) { m_args.push_back(Argument(this,arg)); };
-        inline void simplifyArgs() { for (size_t i=0; i<m_args.size(); ++i) setArg(i,m_args[i].getArg()->simplify()); };
+        inline void addArg( BasicPtr const& arg ) { m_args.push_back(this,arg); hashChanged(); };
+        inline void simplifyArgs() { for (size_t i=0; i<m_args.size(); ++i) setArg(i,m_args[i].getArg()->simplifyCached()); };
         
     private:
         // Arguments
-        ArgumentPtrVec m_args;
+        ArgumentSmallVec m_args;
     };
 
     typedef boost::intrusive_ptr< NaryOp> ConstNaryOpPtr;
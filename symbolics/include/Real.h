@@ -17,12 +17,19 @@ namespace Symbolics
     class Real: public Basic
     {
     public:
+        // Typpruefung fuer Util::getAsConstPtr
+        static inline bool is_Type( Basic const* b ) { return b->getType() == Type_Real; };
+
         // Konstruktor
         Real(  const double value );
         Real(  const Int i );
         ~Real();
         
-        static BasicPtr New( const double r) { return BasicPtr(new Real(r)); };
+        static BasicPtr New( const double r);
+        // Pool: bis zu size verschiedene Werte werden geteilt
+        static void setPoolSize( const size_t size );
+        // Pool leeren, die Knoten liegen in der Arena des Scopes (Util::newScope)
+        static void newScope();
 
         inline double getValue() const { return m_value; };
 
@@ -70,7 +77,11 @@ namespace Symbolics
     protected:
          double m_value;
 
+         // hash nach Wert, wie Int
+         inline size_t calcHash() const { return hashNumber(m_value); };
+
          static BasicPtr getArgres;
+         static size_t m_poolSize;
     };
 
     // Operatoren mit Real
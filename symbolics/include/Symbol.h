@@ -48,6 +48,9 @@ namespace Symbolics
     class Symbol: public Basic
     {
     public:
+        // Typpruefung fuer Util::getAsConstPtr
+        static inline bool is_Type( Basic const* b ) { return b->getType() == Type_Symbol; };
+
         // Konstruktor
         Symbol( std::string const& name,  Shape const& shape,  Symbol_Kind category = VARIABLE );
         // Konstruktor (Skalar)
@@ -57,7 +60,13 @@ namespace Symbolics
 
         // toString
         std::string toString() const ; 
-        inline std::string const& getName() const {return m_name;} ;
+        inline std::string const& getName() const {return *m_name;} ;
+        // Id des Namens, gleicher Name <=> gleiche Id
+        inline size_t getId() const { return m_id; };
+
+        // Id zu einem Namen, NO_ID wenn der Name noch nie verwendet wurde
+        static size_t findId( std::string const& name );
+        static const size_t NO_ID = static_cast<size_t>(-1);
 
         // Vereinfachen, wenn unver�ndert, dann NULL
         inline BasicPtr simplify() { return BasicPtr(this); };
@@ -100,8 +109,9 @@ namespace Symbolics
         BasicPtr der(BasicPtr const& symbol);
 
     protected:
-        // Name
-        std::string m_name;
+        // Name (internalisiert) und zugehoerige Id
+        std::string const* m_name;
+        size_t m_id;
         // Kind
         Symbol_Kind m_kind;
         // State
@@ -111,12 +121,14 @@ namespace Symbolics
 
         // user Data
         std::vector<void*> m_userData;
-        void calcHash();
+        size_t calcHash() const;
 #ifdef _DEBUG
         static std::set<std::string> symbol_names;
 #endif
     private:
         static BasicPtr getArgres;
+        // Name in die globale Namenstabelle eintragen
+        void internName( std::string const& name );
 };
 /*****************************************************************************/
     typedef boost::intrusive_ptr<const Symbol> ConstSymbolPtr;
@@ -10,6 +10,9 @@ namespace Symbolics
     class SymmetricMatrix: public Matrix
     {
     public:
+        // Typpruefung fuer Util::getAsConstPtr
+        static inline bool is_Type( Basic const* b ) { return (b->getType() == Type_Matrix) && (dynamic_cast<SymmetricMatrix const*>(b) != NULL); };
+
         // Konstruktor (mit Nullen f�llen)
         SymmetricMatrix( Shape const& shape );
         // Konstruktor (mit Array)
@@ -24,6 +27,10 @@ namespace Symbolics
 
         BasicPtr iterateExp(Symbolics::Basic::Iterator &v);
 
+        // Vergleich, zwei SymmetricMatrix nur ueber das obere Dreieck
+        bool operator==( Basic const& rhs) const;
+        bool operator<(Basic  const& rhs) const;
+
          // Operatoren
         SymmetricMatrix operator+( SymmetricMatrix const& rhs) const;
         SymmetricMatrix operator+( Int const& rhs) const;
@@ -73,6 +80,9 @@ namespace Symbolics
         inline size_t getNumEl() const { return ((m_shape.getDimension(1)+1)*m_shape.getDimension(1))/2; };
 
     protected:
+        BasicPtr newWithArgs( BasicPtrVec &args ) const;
+        inline Matrix* newMatrix() const { return new SymmetricMatrix(m_shape); };
+
         inline size_t getIndex(size_t row, size_t col) const 
         { 
           size_t n = m_shape.getDimension(1);
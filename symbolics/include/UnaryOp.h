@@ -10,6 +10,9 @@ namespace Symbolics
     class UnaryOp: public Basic
     {
     public:
+        // Typpruefung fuer Util::getAsConstPtr
+        static inline bool is_Type( Basic const* b ) { return dynamic_cast<UnaryOp const*>(b) != NULL; };
+
         // Konstruktor
         UnaryOp(  Basic_Type type,  BasicPtrVec const& args );        
         // Konstruktor
@@ -36,7 +39,7 @@ namespace Symbolics
 
     protected:
         inline void setArg( BasicPtr const& arg) { m_arg.setArg(arg); };
-        inline void simplifyArg() { setArg(getArg()->simplify()); };
+        inline void simplifyArg() { setArg(getArg()->simplifyCached()); };
     
     private:
         // Arguments
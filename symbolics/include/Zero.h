@@ -10,6 +10,9 @@ namespace Symbolics
     class Zero: public Basic
     {
     public:
+        // Typpruefung fuer Util::getAsConstPtr
+        static inline bool is_Type( Basic const* b ) { return b->getType() == Type_Zero; };
+
         Zero();
         Zero(Shape const& s);
 
@@ -44,6 +47,8 @@ namespace Symbolics
         inline static BasicPtr & getZero() { return zero; };
         static BasicPtr getZero(Shape const& s);
         static BasicPtr getExactZero(Shape const& s);
+        // Pool leeren, die Knoten liegen in der Arena des Scopes (Util::newScope)
+        static void newScope();
 
         // derivative
         inline BasicPtr der() { return BasicPtr(this); };
@@ -51,6 +56,11 @@ namespace Symbolics
 
     protected:
         static BasicPtr zero;
+        // geteilte Nullen je Shape
+        static BasicPtr const& getPooled(Shape const& s);
+
+        // hash unabhaengig vom Shape, wie Int(0) und Real(0.0)
+        inline size_t calcHash() const { return hashNumber(0); };
 
         static BasicPtr getArgres;
 
@@ -35,6 +35,9 @@ namespace boost
 ///
 ///          (p != 0)
 ///
+///  found by argument dependent lookup, i.e. declared in the namespace of T
+///  (Symbolics, Symbolics::Graph).
+///
 ///  The object is responsible for destroying itself.
 ///
 ///  See: http://www.boost.org/doc/libs/release/libs/smart_ptr
@@ -78,21 +81,33 @@ public:
         if(p_ != 0) intrusive_ptr_release(p_);
     }
 
-    virtual void intrusive_ptr_add_ref(const T* p) {}
-    
-    virtual void intrusive_ptr_release(const T* p) {}
-
     template<class U> intrusive_ptr(intrusive_ptr<U> const & rhs): p_(rhs.get())
     {
         if(p_ != 0) intrusive_ptr_add_ref(p_);
     }
 
+    // Move: uebernimmt die Referenz, kein add_ref / release
+    intrusive_ptr(intrusive_ptr && rhs) noexcept: p_(rhs.p_)
+    {
+        rhs.p_ = 0;
+    }
+
+    template<class U> intrusive_ptr(intrusive_ptr<U> && rhs) noexcept: p_(rhs.release())
+    {
+    }
+
     intrusive_ptr & operator=(intrusive_ptr const & rhs)
     {
         this_type(rhs).swap(*this);
         return *this;
     }
 
+    intrusive_ptr & operator=(intrusive_ptr && rhs) noexcept
+    {
+        this_type(static_cast<intrusive_ptr &&>(rhs)).swap(*this);
+        return *this;
+    }
+
     intrusive_ptr & operator=(T * rhs)
     {
         this_type(rhs).swap(*this);
@@ -504,6 +504,28 @@ int main( int argc,  char *argv[])
     cbool_true.getAtoms(atoms);
     if (atoms.size() != 0) return -2042;
 
+#pragma endregion
+
+#pragma region Pool
+
+    // gleiche Konstanten werden geteilt
+    if (Int::New(42).get() != Int::New(42).get()) return -2100;
+    if (Int::New(42)->getType() != Type_Int) return -2101;
+    if (Real::New(1.5).get() != Real::New(1.5).get()) return -2102;
+    if (Real::New(0.0).get() == Real::New(-0.0).get()) return -2103;
+    if (Zero::getZero(Shape(3)).get() != Zero::getZero(Shape(3)).get()) return -2104;
+    if (Zero::getZero(Shape(3)).get() == Zero::getZero(Shape(2,3)).get()) return -2105;
+    if (Eye::getEye(Shape(3,3)).get() != Eye::getEye(Shape(3,3)).get()) return -2106;
+    if (Zero::getExactZero(Shape(1,1))->getShape() != Shape(1,1)) return -2107;
+    // ausserhalb des Bereichs neu anlegen
+    Int::setPoolRange(-2,2);
+    if (Int::New(42).get() == Int::New(42).get()) return -2108;
+    if (Int::New(2).get() != Int::New(2).get()) return -2109;
+    Int::setPoolRange(-128,1024);
+    Real::setPoolSize(0);
+    if (Real::New(1.5).get() == Real::New(1.5).get()) return -2110;
+    Real::setPoolSize(4096);
+
 #pragma endregion
 
     return 0;
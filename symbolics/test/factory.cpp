@@ -0,0 +1,141 @@
+#include <iostream>
+#include "Symbolics.h"
+#include "Factory.h"
+
+using namespace Symbolics;
+
+int main( int argc,  char *argv[])
+{
+    Util::newScope();
+    InternScopePtr scope = Factory::getScope();
+    if (scope->size() != 0) return -1;
+
+    BasicPtr a(new Symbol("a"));
+    BasicPtr b(new Symbol("b"));
+
+    // gleiche Ausdruecke werden geteilt
+    BasicPtr s1 = Sin::New(a);
+    BasicPtr s2 = Sin::New(a);
+    if (s1.get() != s2.get()) return -2;
+    if (scope->size() != 1) return -3;
+    BasicPtr s3 = Sin::New(b);
+    if (s1.get() == s3.get()) return -4;
+    if (scope->size() != 2) return -5;
+
+    BasicPtr m1 = Mul::New(s1,b);
+    BasicPtr m2 = Mul::New(s2,b);
+    if (m1.get() != m2.get()) return -6;
+    BasicPtr m3 = Mul::New(b,s1);
+    if (m1.get() == m3.get()) return -7;
+
+    // Konstanten werden nach Wert verglichen
+    BasicPtr e1 = Element::New(BasicPtr(new Symbol("M",Shape(3,3))),1,2);
+    BasicPtr M = e1->getArg(0);
+    BasicPtr e2 = Element::New(M,1,2);
+    if (e1.get() != e2.get()) return -8;
+    BasicPtr e3 = Element::New(M,2,1);
+    if (e1.get() == e3.get()) return -9;
+
+    // Factory
+    BasicPtrVec args;
+    args.push_back(a);
+    args.push_back(b);
+    BasicPtr f1 = Factory::newBasic(Type_Add,args,Shape());
+    BasicPtr f2 = Add::New(a,b);
+    if (f1.get() != f2.get()) return -10;
+
+    // Matrizen werden nicht geteilt, set aendert nur die eine
+    BasicPtr mat1 = Factory::newBasic(Type_Matrix,args,Shape(2));
+    BasicPtr mat2 = Factory::newBasic(Type_Matrix,args,Shape(2));
+    if (mat1.get() == mat2.get()) return -29;
+    Matrix *pm = dynamic_cast<Matrix*>(mat1.get());
+    pm->set(0,s3);
+    if (mat2->getArg(0) != a) return -30;
+    if (mat1 == mat2) return -31;
+    BasicPtrVec sargs;
+    sargs.push_back(a);
+    sargs.push_back(b);
+    sargs.push_back(s1);
+    BasicPtr sym1(new SymmetricMatrix(sargs,Shape(2,2)));
+    BasicPtr sym2(new SymmetricMatrix(sargs,Shape(2,2)));
+    if (Factory::unique(sym1).get() != sym1.get()) return -32;
+    if (Factory::unique(sym2).get() != sym2.get()) return -33;
+
+    // neuer Scope teilt nicht mit dem alten
+    Util::newScope();
+    if (Factory::getScope()->size() != 0) return -11;
+    BasicPtr s4 = Sin::New(a);
+    if (s1.get() == s4.get()) return -12;
+    if (s1 != s4) return -13;
+
+    // abgeschaltet
+    Factory::setInterning(false);
+    BasicPtr s5 = Sin::New(a);
+    Factory::setInterning(true);
+    if (s4.get() == s5.get()) return -14;
+
+    // simplify Cache: gleiche Ausdruecke aus verschiedenen Gleichungen nur einmal vereinfachen
+    Util::newScope();
+    scope = Factory::getScope();
+    BasicPtr one(new Int(1));
+    BasicPtr p1(new Add(a, BasicPtr(new Mul(b, one))));
+    BasicPtr p2(new Add(a, BasicPtr(new Mul(b, BasicPtr(new Int(1))))));
+    BasicPtr r1 = p1->simplifyCached();
+    if (scope->getSimplifyHits() != 0) return -15;
+    if (scope->getSimplifyMisses() == 0) return -16;
+    BasicPtr r2 = p2->simplifyCached();
+    if (scope->getSimplifyHits() == 0) return -17;
+    if (r1 != r2) return -18;
+    if (r2 != p2->simplify()) return -19;
+    // der Cache ist begrenzt und haelt danach nichts mehr fest
+    InternScope::setSimplifySize(2);
+    if (scope->getSimplifySize() > 2) return -34;
+    for (size_t i=0; i<10; ++i)
+    {
+        BasicPtr pi(new Add(a, BasicPtr(new Mul(b, BasicPtr(new Int(static_cast<int>(i)+2))))));
+        pi->simplifyCached();
+        if (scope->getSimplifySize() > 2) return -35;
+    }
+    InternScope::setSimplifySize(0);
+    if (scope->getSimplifySize() != 0) return -36;
+    BasicPtr(new Add(b, BasicPtr(new Mul(a, one))))->simplifyCached();
+    if (scope->getSimplifySize() != 0) return -37;
+    InternScope::setSimplifySize(65536);
+
+    // BasicPtr ist nur ein Zeiger, Knoten werden freigegeben
+    if (sizeof(BasicPtr) != sizeof(Basic*)) return -20;
+    ArenaPtr arena = Arena::getScope();
+    size_t objects = arena->getObjects();
+    {
+        BasicPtr t(new Symbol("t"));
+        BasicPtr m(std::move(t));
+        if (t.get() != NULL) return -21;
+        if (arena->getObjects() != objects+1) return -22;
+    }
+    if (arena->getObjects() != objects) return -23;
+    // tiefe Ketten werden ohne Rekursion freigegeben
+    {
+        BasicPtr deep(new Symbol("t"));
+        for (size_t i=0; i<200000; ++i)
+            deep = BasicPtr(new Neg(deep));
+    }
+    if (arena->getObjects() != objects) return -24;
+
+    // geteilte Konstanten gehoeren zum Scope und halten dessen Arena nicht fest
+    Util::newScope();
+    ArenaPtr old = Arena::getScope();
+    {
+        BasicPtr r = Real::New(123.25);
+        BasicPtr i = Int::New(77);
+        BasicPtr z = Zero::getZero(Shape(7));
+        BasicPtr e = Eye::getEye(Shape(7,7));
+        if (old->getObjects() == 0) return -25;
+    }
+    Util::newScope();
+    if (old->getObjects() != 0) return -26;
+    // im neuen Scope wird wieder geteilt
+    if (Real::New(123.25).get() != Real::New(123.25).get()) return -27;
+    if (Zero::getZero(Shape(7)).get() != Zero::getZero(Shape(7)).get()) return -28;
+
+    return 0;
+}
@@ -0,0 +1,52 @@
+#include <iostream>
+#include "Symbolics.h"
+
+using namespace Symbolics;
+
+int main( int argc,  char *argv[])
+{
+    BasicPtr a(new Symbol("a"));
+    BasicPtr b(new Symbol("b"));
+    BasicPtr c(new Symbol("c"));
+    BasicPtr d(new Symbol("d"));
+
+    // Zahlen nach Wert
+    if (BasicPtr(new Int(2))->getHash() != BasicPtr(new Real(2.0))->getHash()) return -1;
+    if (Zero::getZero()->getHash() != BasicPtr(new Real(0.0))->getHash()) return -2;
+    if (Zero::getZero(Shape(3))->getHash() != BasicPtr(new Matrix(Shape(3)))->getHash()) return -3;
+    if (BasicPtr(new Int(2))->getHash() == BasicPtr(new Int(3))->getHash()) return -4;
+
+    // Add ist vertauschbar
+    BasicPtr ab(new Add(a,b));
+    BasicPtr ba(new Add(b,a));
+    if (ab->getHash() != ba->getHash()) return -5;
+    if (ab != ba) return -6;
+    BasicPtr ac(new Add(a,c));
+    if (ab->getHash() == ac->getHash()) return -7;
+
+    // Mul nur bei Skalaren
+    BasicPtr A(new Symbol("A",Shape(2,2)));
+    BasicPtr B(new Symbol("B",Shape(2,2)));
+    BasicPtr AB(new Mul(A,B));
+    BasicPtr BA(new Mul(B,A));
+    if (AB->getHash() == BA->getHash()) return -8;
+    if (BasicPtr(new Mul(a,b))->getHash() != BasicPtr(new Mul(b,a))->getHash()) return -9;
+
+    // Funktionen
+    BasicPtr sa(new Sin(a));
+    BasicPtr sb(new Sin(b));
+    if (sa->getHash() == sb->getHash()) return -10;
+    if (sa->getHash() == BasicPtr(new Cos(a))->getHash()) return -11;
+
+    // Ersetzen im Baum macht den Hash ungueltig
+    BasicPtr mc(new Mul(b,c));
+    BasicPtr exp(new Add(a,mc));
+    size_t before = exp->getHash();
+    c->subs(d);
+    if (exp->getHash() == before) return -12;
+    BasicPtr exp2(new Add(a,BasicPtr(new Mul(b,d))));
+    if (exp->getHash() != exp2->getHash()) return -13;
+    if (exp != exp2) return -14;
+
+    return 0;
+}
@@ -388,6 +388,32 @@ int main( int argc,  char *argv[])
     BasicPtr dercmdblmatrix = cmdblmatrix.der();
     if (!Util::is_Zero(dercmdblmatrix)) return -1300;
 
+#pragma endregion
+
+#pragma region Sparse
+
+    // Drehmatrix: nur die Nicht-Nullen werden multipliziert
+    BasicPtr z = Zero::getZero();
+    BasicPtr one = Int::getOne();
+    BasicPtr mas = -as;
+    Matrix rot( Shape(3,3) );
+    rot = bs,mas,z,
+          as,bs,z,
+          z,z,one;
+    Matrix rv( rot*v );
+    if (rv.getShape() != Shape(3)) return -1400;
+    if (rv(0) != bs*v(0) + mas*v(1)) return -1401;
+    if (rv(1) != as*v(0) + bs*v(1)) return -1402;
+    if (rv(2) != v(2)) return -1403;
+    Matrix rr( rot*rot );
+    if (rr(0,2) != z) return -1404;
+    if (rr(2,2) != one) return -1405;
+    if (rr(0,0) != bs*bs + mas*as) return -1406;
+    // Zeile nur aus Nullen
+    Matrix zm( Shape(2,3) );
+    Matrix zr( zm*rot );
+    if (!Util::is_Zero(BasicPtr(new Matrix(zr)))) return -1407;
+
 #pragma endregion
 
     return 0;
@@ -143,6 +143,25 @@ int add( int &argc,  char *argv[])
     std::cout << ref->toString() << std::endl;
     if (tmps != ref) return -30;
 
+    // viele Summanden: gleiche Terme zusammenfassen, Reihenfolge wie bisher sortiert
+    BasicPtrVec terms;
+    BasicPtrVec xs;
+    for (size_t i=0; i<300; ++i)
+        xs.push_back(BasicPtr(new Symbol("x" + str(i))));
+    for (size_t i=0; i<300; ++i)
+    {
+        terms.push_back(xs[299-i]);
+        terms.push_back(BasicPtr(new Mul(Int::New(2),xs[i])));
+    }
+    BasicPtr big = BasicPtr(new Add(terms))->simplify();
+    if (big->getArgsSize() != 300) return -31;
+    for (size_t i=0; i<big->getArgsSize(); ++i)
+    {
+        if (big->getArg(i)->getType() != Type_Mul) return -32;
+        if (big->getArg(i)->getArg(0)->getType() != Type_Int) return -33;
+        if (i>0 && !(big->getArg(i-1)->getArg(1) < big->getArg(i)->getArg(1))) return -34;
+    }
+
     return 0;
 }
 
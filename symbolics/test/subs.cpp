@@ -3,6 +3,15 @@
 
 using namespace Symbolics;
 
+// zaehlt die Aufrufe von process_Arg
+class CountIterator: public Basic::Iterator
+{
+public:
+    CountIterator(): count(0) {;}
+    BasicPtr process_Arg(BasicPtr const &p) { ++count; return p; }
+    size_t count;
+};
+
 int main( int argc,  char *argv[])
 {
     // Beispiel aufbauen
@@ -79,7 +88,11 @@ int main( int argc,  char *argv[])
 
     // 
     BasicPtr exp12 = Add::New(a,Mul::New(a,Util::div(a,Pow::New(Util::sqrt(a),Int::New(2)))));
+    // Atome werden zwischengespeichert und beim Ersetzen verworfen
+    if (exp12->getAtomList()->size() != 1) return -34;
+    if (!exp12->getAtomList()->contains(a.get())) return -35;
     a->subs(b);
+    if (exp12->getAtomList()->contains(a.get())) return -36;
     Basic::BasicSet atoms =exp12->getAtoms();
     Basic::BasicSet::iterator found = atoms.find(a);
     if (found != atoms.end()) return -20;
@@ -87,10 +100,93 @@ int main( int argc,  char *argv[])
     found = atoms.find(b);
     if (found == atoms.end()) return -21;
 
+    // Parents: alle Kanten von a sind auf b umgehaengt
+    if (a->getParentsSize() != 0) return -23;
+    if (b->getParentsSize() == 0) return -24;
+
+    // Parents bleiben beim Umkopieren der Argumente erhalten
+    BasicPtr d(new Symbol("d"));
+    BasicPtrVec dargs;
+    for (size_t i=0; i<10; ++i)
+        dargs.push_back(d);
+    BasicPtr dsum(new Add(dargs));
+    if (d->getParentsSize() != 10) return -25;
+    d->subs(c);
+    if (d->getParentsSize() != 0) return -26;
+    if (c->getParentsSize() != 10) return -27;
+    if (dsum->getArg(9) != c) return -28;
+    // wenige Argumente liegen im Knoten selbst
+    BasicPtr e(new Symbol("e"));
+    BasicPtr esum(new Add(e, e));
+    if (e->getParentsSize() != 2) return -47;
+    e->subs(c);
+    if (esum->getArg(0) != c || esum->getArg(1) != c) return -48;
+
     // subs(der(a),b)
     BasicPtr dera = Der::New(a);
     BasicPtr exp13 = dera->subs(Der::New(a),b);
     if (exp13 != b) return -22;
 
+    // geteilte Teilausdruecke: ohne Memo 2^40 Aufrufe
+    BasicPtr x(new Symbol("x"));
+    BasicPtr y(new Symbol("y"));
+    BasicPtr chain = x;
+    for (size_t i=0; i<40; ++i)
+        chain = BasicPtr(new Add(chain, BasicPtr(new Neg(chain))));
+    BasicPtr chainy = chain->subs(x,y);
+    // Teilausdruecke bleiben geteilt
+    if (chainy->getArg(0).get() != chainy->getArg(1)->getArg(0).get()) return -29;
+    BasicPtr leaf = chainy;
+    for (size_t i=0; i<40; ++i)
+    {
+        if (leaf->getArg(0).get() != leaf->getArg(1)->getArg(0).get()) return -30;
+        leaf = leaf->getArg(0);
+    }
+    if (leaf != y) return -31;
+    // Teilbaeume ohne das Symbol bleiben unveraendert
+    BasicPtr z(new Symbol("z"));
+    if (chain->subs(z,y).get() != chain.get()) return -37;
+    if (!chain->mayContain(x.get())) return -38;
+    if (chain->mayContain(Add::New(x,z).get())) return -39;
+    // mehrere Ersetzungen in einem Durchlauf, gleichzeitig (x und y tauschen)
+    BasicPtrMap repl;
+    repl[x] = y;
+    repl[y] = x;
+    BasicPtr xyz(new Add(x, BasicPtr(new Mul(y,z))));
+    BasicPtr yxz = xyz->subs(repl);
+    if (yxz->getArg(0) != y) return -40;
+    if (yxz->getArg(1)->getArg(0) != x) return -41;
+    if (yxz->getArg(1)->getArg(1) != z) return -42;
+    BasicPtr chainm = chain->subs(repl);
+    if (chainm->getArg(0).get() != chainm->getArg(1)->getArg(0).get()) return -43;
+    BasicPtrMap zrepl;
+    zrepl[z] = y;
+    if (chain->subs(zrepl).get() != chain.get()) return -44;
+
+    // nach subs werden die Parents neu vereinfacht
+    BasicPtr p(new Symbol("p"));
+    BasicPtr q(new Symbol("q"));
+    BasicPtr pq(new Add(p, q));
+    pq = pq->simplify();
+    q->subs(Neg::New(p));
+    if (pq->simplify() != Int::getZero()) return -45;
+    // tiefe Parent-Ketten, ohne Rekursion beim Ersetzen
+    BasicPtr deep = q;
+    for (size_t i=0; i<200000; ++i)
+        deep = BasicPtr(new Neg(deep));
+    q->subs(p);
+    if (q->getParentsSize() != 0) return -46;
+    // Ersetzung tief unten, auch die Vorfahren weiter oben vereinfachen neu
+    BasicPtr r(new Symbol("r"));
+    BasicPtr npr(new Neg(BasicPtr(new Mul(BasicPtr(new Int(2)), BasicPtr(new Add(p, r))))));
+    npr = npr->simplify();
+    r->subs(Neg::New(p));
+    if (npr->simplify() != Int::getZero()) return -47;
+    // jeder Knoten wird genau einmal bearbeitet
+    CountIterator count;
+    BasicPtr chaini = chain->iterateExp(count);
+    if (count.count != 2*40+1) return -32;
+    if (chaini->getArg(0).get() != chaini->getArg(1)->getArg(0).get()) return -33;
+
     return 0;
 }
\ No newline at end of file
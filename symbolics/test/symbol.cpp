@@ -104,6 +104,17 @@ int main( int argc,  char *argv[])
     if (b < a) return -53;
     if (d < e) return -54;
 
+    // Namen werden internalisiert, gleicher Name gleiche Id
+    const Symbol *sa = Util::getAsConstPtr<Symbol>(a);
+    const Symbol *sb = Util::getAsConstPtr<Symbol>(b);
+    if (sa->getId() == sb->getId()) return -55;
+    if (Symbol::findId("a") != sa->getId()) return -56;
+    if (Symbol::findId("gibt_es_nicht") != Symbol::NO_ID) return -57;
+#ifndef _DEBUG
+    if (Util::getAsConstPtr<Symbol>(a1)->getId() != sa->getId()) return -58;
+    if (a1->getHash() != a->getHash()) return -59;
+#endif
+
 #pragma region Derivative
 
     BasicPtr dera = a->der();
@@ -117,6 +128,21 @@ int main( int argc,  char *argv[])
     if (derab != Zero::getZero() ) return -102;
 #endif
 
+#pragma endregion
+
+#pragma region Walker
+
+    // tiefe Ausdruecke ohne Rekursion durchlaufen
+    BasicPtr deep = a;
+    for (size_t i=0; i<200000; ++i)
+        deep = BasicPtr(new Neg(deep));
+    Basic::LookFor lookfora(a);
+    deep->walkExp(lookfora);
+    if (!lookfora.found) return -200;
+    Basic::LookFor lookforb(b);
+    deep->walkExp(lookforb);
+    if (lookforb.found) return -201;
+
 #pragma endregion
 
     return 0;
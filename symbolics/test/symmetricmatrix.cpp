@@ -242,5 +242,35 @@ int main( int argc,  char *argv[])
     }
     catch (...) { return -246; };
 
+    try {
+#pragma region gepackt
+    // nur das obere Dreieck wird gespeichert
+    if (m.getArgsSize() != 6) return -250;
+    SymmetricMatrix *pm = new SymmetricMatrix(m);
+    BasicPtr sm(pm);
+    // Transponieren gibt die gleiche Matrix zurueck
+    if (Transpose::New(sm).get() != sm.get()) return -251;
+    if (BasicPtr(new Transpose(sm))->simplify().get() != sm.get()) return -251;
+    // Neg bleibt gepackt und an der richtigen Stelle
+    BasicPtr nm = BasicPtr(new Neg(sm))->simplify();
+    if (!SymmetricMatrix::is_Type(nm.get())) return -252;
+    const Matrix *cnm = Util::getAsConstPtr<Matrix>(nm);
+    if (cnm->getArgsSize() != 6) return -253;
+    if ((*cnm)(2,1) != -m(1,2)) return -254;
+    // Ableitung bleibt gepackt
+    BasicPtr dm = sm->der(as);
+    if (!SymmetricMatrix::is_Type(dm.get())) return -255;
+    if (Util::getAsConstPtr<Matrix>(dm)->get(0,0) != Int::getOne()) return -256;
+    // Vergleich mit voller Matrix
+    BasicPtr full(new Matrix(m));
+    if (!(*full == *sm) || !(*sm == *full)) return -257;
+    if ((*sm < *full) || (*full < *sm)) return -258;
+    // Skalar mal SymmetricMatrix
+    SymmetricMatrix m2( Int(2) * m );
+    if (m2(2,2) != Int(2)*m(2,2)) return -259;
+#pragma endregion
+    }
+    catch (...) { return -260; };
+
     return 0;
 }
\ No newline at end of file
@@ -53,6 +53,24 @@ int getas( int &argc,  char *argv[])
     }
     catch (InternalError) {  }
     catch (...) { return -3; };
+
+    // Basisklassen und Matrix/SymmetricMatrix (gleicher Typ)
+    BasicPtr sym( new SymmetricMatrix(Shape(2,2)) );
+    BasicPtr mat( new Matrix(Shape(2,2)) );
+    try
+    {
+        if (Util::getAsConstPtr<Matrix>(sym) != sym.get()) return -4;
+        if (Util::getAsConstPtr<SymmetricMatrix>(sym) != sym.get()) return -5;
+        if (Util::getAsConstPtr<NaryOp>(mat) != mat.get()) return -6;
+    }
+    catch (...) { return -7; };
+    try
+    {
+        Util::getAsConstPtr<SymmetricMatrix>(mat);
+        return -8;
+    }
+    catch (InternalError) {  }
+    catch (...) { return -9; };
     // Alles ok.
     return 0;
 }
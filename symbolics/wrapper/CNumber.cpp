@@ -98,7 +98,7 @@ static int CNumber_init(CNumberObject *self, PyObject *args, PyObject *kwds)
 		if (PyLong_Check(item))
 			self->m_basic = Int::New( PyLong_AsLong(item) );
 		else if (PyFloat_Check(item))
-			self->m_basic = BasicPtr( new Real( PyFloat_AsDouble(item) ) );
+			self->m_basic = Real::New(PyFloat_AsDouble(item));
 		else
 		{
 			PyErr_SetString(SymbolicsError, "Argument must be either int or float!");
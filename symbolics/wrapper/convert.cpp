@@ -80,7 +80,7 @@ BasicPtr toBasic( PyObject *o, Graph::Graph* &g)
     {
         // Konstante zurueckgeben
          double val = PyFloat_AsDouble(o);
-        return BasicPtr( new Real(val) );
+        return Real::New(val);
     }
     // Integer
     if (typeName == "Integer")
@@ -127,7 +127,7 @@ BasicPtr toBasic( PyObject *o, Graph::Graph* &g)
         // Args: arg, dim1, dim2
         BasicPtr arg = toBasic( PyTuple_GetItem(args, 0), g );
          double exponent = PyFloat_AsDouble( PyTuple_GetItem(args, 1) );
-        BasicPtr exp(new Real(exponent));
+        BasicPtr exp(Real::New(exponent));
         return Pow::New(arg, exp);
     }
     // Cosinus
@@ -222,7 +222,7 @@ BasicPtr toBasic( PyObject *o, Graph::Graph* &g)
         return toUnary<Atan>(o,g);
     // Pi
     if (typeName == "Pi")
-        return BasicPtr( new Real( M_PI ) );
+        return Real::New(M_PI);
     // Der
     if (typeName == "der")
         return toUnary<Der>(o,g);
@@ -237,7 +237,7 @@ BasicPtr toBasic( PyObject *o, Graph::Graph* &g)
         return toUnary<Asin>(o,g);
     // Half
     if (typeName == "Half")
-        return BasicPtr( new Real(0.5) );
+        return Real::New(0.5);
     // Scalar
     if (typeName == "scalar")
         return toUnary<Scalar>(o,g);
@@ -444,7 +444,7 @@ BasicPtr getBasic( PyObject *o )
         return BasicPtr( new Int( PyLong_AsLong(o) ) );
     // Type == float
     if (PyFloat_Check(o))
-        return BasicPtr( new Real( PyFloat_AsDouble(o) ) );
+        return Real::New(PyFloat_AsDouble(o));
 
     // Es hat nicht geklappt
 	throw InternalError("Object could not be cast into a basic!");
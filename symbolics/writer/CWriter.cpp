@@ -157,8 +157,13 @@ double CWriter::generateDerState(Graph::Graph& g, int &dim)
         f << "    double " << m_p->print(*it) << m_p->dimension(*it) << "= " << m_p->print(g.getinitVal(*it)) << "; " << m_p->comment2(g,*it) <<  std::endl;
 	f << std::endl;
 	
+	std::vector<Graph::Assignment> equations = a->getEquations(PARAMETER | CONSTANT | INPUT );
+	bool newton = hasNewtonBlock(equations);
+	if (newton)
+		f << "    int newton_status = 0; /* 1: implicit block not converged, 2: singular Jacobian */" << std::endl << std::endl;
+
 	f << "/* calculate state derivative */" << std::endl;
-	f << writeEquations(a->getEquations(PARAMETER | CONSTANT | INPUT )) << std::endl;
+	f << writeEquations(equations) << std::endl;
     f << std::endl;
 
 	f << "/* set return values */" << std::endl;
@@ -182,7 +187,7 @@ double CWriter::generateDerState(Graph::Graph& g, int &dim)
 
 	//f << ss.rdbuf();
 
-	f << "	return 0;" << std::endl;
+	f << "	return " << (newton ? "newton_status" : "0") << ";" << std::endl;
 	f << "}" << std::endl;
 
 	f.close();
@@ -269,11 +274,16 @@ double CWriter::generateVisual(Graph::Graph& g)
         f << "    double " << m_p->print(*it) << m_p->dimension(*it) << "= " << m_p->print(g.getinitVal(*it)) << "; " << m_p->comment2(g,*it) <<  std::endl;
 	f << std::endl;
 
+	std::vector<Graph::Assignment> equations = a->getEquations(PARAMETER | CONSTANT | INPUT );
+	bool newton = hasNewtonBlock(equations);
+	if (newton)
+		f << "    int newton_status = 0; /* 1: implicit block not converged, 2: singular Jacobian */" << std::endl << std::endl;
+
 	f << "/* calculate visual sensors */" << std::endl;
-	f << writeEquations(a->getEquations(PARAMETER | CONSTANT | INPUT )) << std::endl;
+	f << writeEquations(equations) << std::endl;
     f << std::endl;
 
-	f << "	return 0;" << std::endl;
+	f << "	return " << (newton ? "newton_status" : "0") << ";" << std::endl;
 	f << "}" << std::endl;
 	
 	f.close();
@@ -368,11 +378,16 @@ double CWriter::generateSensors(Graph::Graph& g)
         f << "    double " << m_p->print(*it) << m_p->dimension(*it) << "= " << m_p->print(g.getinitVal(*it)) << "; " << m_p->comment2(g,*it) <<  std::endl;
 	f << std::endl;
 
+	std::vector<Graph::Assignment> equations = a->getEquations(PARAMETER | CONSTANT | INPUT );
+	bool newton = hasNewtonBlock(equations);
+	if (newton)
+		f << "    int newton_status = 0; /* 1: implicit block not converged, 2: singular Jacobian */" << std::endl << std::endl;
+
 	f << "/* calculate sensors */" << std::endl;
-	f << writeEquations(a->getEquations(PARAMETER | CONSTANT | INPUT )) << std::endl;
+	f << writeEquations(equations) << std::endl;
     f << std::endl;
 
-	f << "	return 0;" << std::endl;
+	f << "	return " << (newton ? "newton_status" : "0") << ";" << std::endl;
 	f << "}" << std::endl;
 	
 	f.close();
@@ -394,35 +409,154 @@ std::string CWriter::writeEquations(std::vector<Graph::Assignment> const& equati
 	for (std::vector<Graph::Assignment>::const_iterator it=equations.begin(); it!=equations.end(); ++it)
     {
         if (it->implizit)
-            throw InternalError("Implicit equations are not yet implemented in C!");
-		//Folgendes falls mehrere Gleichungen in einer verpackt sind (wird aber scheinbar kaum genutzt)
-		for (size_t i=0; i < it->lhs.size(); ++i)
         {
-            BasicPtr simple_exp = it->rhs[i]->simplify();
-            if (simple_exp.get() == NULL) throw InternalError("CWriter: Value of Rhs is not Valid!");
-
-			//Workaround: Solve muss speziell behandelt werden TODO: Irgendwie ist das nicht sch�n und deckt bestimmt nicht alle F�lle ab
-			if (it->rhs[i]->getType() == Type_Solve) 
-			{
-				const Solve *solve = Util::getAsConstPtr<Solve>(it->rhs[i]);
-				//Util::getAsConstPtr<Element>(it->lhs[i]->getArg(0)->getArg(0));
-				int dim = solve->getArg2()->getShape().getDimension(1);
-				s << "    {" << std::endl;
-				s << "        double solve_A[" << dim << "][" << dim << "] = " << m_p->print(solve->getArg1()) << ";" << std::endl;
-				s << "        double solve_b[" << dim << "] = " << m_p->print(solve->getArg2()) << ";" << std::endl;
-				s << "        legs(solve_A, solve_b, " << m_p->print(it->lhs[i]->getArg(0)->getArg(0)) << ");" << std::endl;
-				s << "    }" << std::endl;
-			} else {
-				// ordinary equation
-				s << "    " << m_p->print(it->lhs[i]) << " = " << m_p->print(simple_exp) << ";" << std::endl;
-			}
+            s << writeNewtonBlock(*it);
+            continue;
         }
+		//Folgendes falls mehrere Gleichungen in einer verpackt sind (wird aber scheinbar kaum genutzt)
+		for (size_t i=0; i < it->lhs.size(); ++i)
+            s << writeAssignment(it->lhs[i], it->rhs[i], "    ");
     }
 
 	return s.str();
 }
 /*****************************************************************************/
 
+/*****************************************************************************/
+std::string CWriter::writeAssignment(BasicPtr const& lhs, BasicPtr const& rhs, std::string const& indent) const
+/*****************************************************************************/
+{
+	std::stringstream s;
+
+    BasicPtr simple_exp = rhs->simplify();
+    if (simple_exp.get() == NULL) throw InternalError("CWriter: Value of Rhs is not Valid!");
+
+	//Workaround: Solve muss speziell behandelt werden TODO: Irgendwie ist das nicht sch�n und deckt bestimmt nicht alle F�lle ab
+	if (rhs->getType() == Type_Solve)
+	{
+		const Solve *solve = Util::getAsConstPtr<Solve>(rhs);
+		int dim = solve->getArg2()->getShape().getDimension(1);
+		s << indent << "{" << std::endl;
+		s << indent << "    double solve_A[" << dim << "][" << dim << "] = " << m_p->print(solve->getArg1()) << ";" << std::endl;
+		s << indent << "    double solve_b[" << dim << "] = " << m_p->print(solve->getArg2()) << ";" << std::endl;
+		s << indent << "    legs(solve_A, solve_b, " << m_p->print(lhs->getArg(0)->getArg(0)) << ");" << std::endl;
+		s << indent << "}" << std::endl;
+	} else {
+		// ordinary equation
+		s << indent << m_p->print(lhs) << " = " << m_p->print(simple_exp) << ";" << std::endl;
+	}
+
+	return s.str();
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+std::string CWriter::writeNewtonBlock(Graph::Assignment const& a) const
+/*****************************************************************************/
+{
+	// Gedaempftes Newton Verfahren fuer die Tearing Variablen, Startwert ist
+	// die Loesung des letzten Aufrufs (static, daher nicht reentrant).
+	// Fehler landen in newton_status der umgebenden Funktion
+	NewtonBlock block = getNewtonBlock(a);
+	size_t n = block.unknowns.size();
+	std::string dim = str(n);
+	std::stringstream s;
+
+	s << "    {" << std::endl;
+	s << "        /* implicit block: damped Newton iteration for";
+	for (size_t i=0; i < n; ++i)
+		s << " " << m_p->print(block.unknowns[i]);
+	s << " */" << std::endl;
+	s << "        /* warm start from the last call: not reentrant */" << std::endl;
+	s << "        static double newton_x[" << dim << "];" << std::endl;
+	s << "        static int newton_init = 0;" << std::endl;
+	s << "        double newton_r[" << dim << "], newton_dx[" << dim << "], newton_J[" << dim << "][" << dim << "];" << std::endl;
+	s << "        double newton_norm, newton_norm0 = 0, newton_lambda = 1, newton_step = 1, newton_f;" << std::endl;
+	s << "        int newton_it, newton_i, newton_j, newton_l, newton_p;" << std::endl;
+	s << "        if (!newton_init)" << std::endl;
+	s << "        {" << std::endl;
+	for (size_t i=0; i < n; ++i)
+		s << "            newton_x[" << i << "] = " << m_p->print(block.unknowns[i]) << ";" << std::endl;
+	s << "            newton_init = 1;" << std::endl;
+	s << "        }" << std::endl;
+	s << "        for (newton_it = 0; ; ++newton_it)" << std::endl;
+	s << "        {" << std::endl;
+	for (size_t i=0; i < n; ++i)
+		s << "            " << m_p->print(block.unknowns[i]) << " = newton_x[" << i << "];" << std::endl;
+	for (size_t i=0; i < block.lhs.size(); ++i)
+		s << writeAssignment(block.lhs[i], block.rhs[i], "            ");
+	for (size_t i=0; i < n; ++i)
+		s << "            newton_r[" << i << "] = " << m_p->print(block.residuals[i]) << ";" << std::endl;
+	s << "            newton_norm = 0;" << std::endl;
+	s << "            for (newton_i = 0; newton_i < " << dim << "; ++newton_i)" << std::endl;
+	s << "                newton_norm += fabs(newton_r[newton_i]);" << std::endl;
+	s << "            if ((newton_it > 0) && (newton_norm > newton_norm0) && (newton_lambda > 1e-3))" << std::endl;
+	s << "            {" << std::endl;
+	s << "                /* residual grew: halve the step */" << std::endl;
+	s << "                newton_lambda *= 0.5;" << std::endl;
+	s << "                for (newton_i = 0; newton_i < " << dim << "; ++newton_i)" << std::endl;
+	s << "                    newton_x[newton_i] += newton_lambda*newton_dx[newton_i];" << std::endl;
+	s << "                continue;" << std::endl;
+	s << "            }" << std::endl;
+	s << "            if ((newton_norm < 1e-10) || (newton_step < 1e-12) || (newton_it >= 50))" << std::endl;
+	s << "            {" << std::endl;
+	s << "                if (newton_norm >= 1e-10) newton_status = 1;" << std::endl;
+	s << "                break;" << std::endl;
+	s << "            }" << std::endl;
+	s << "            newton_norm0 = newton_norm;" << std::endl;
+	for (size_t i=0; i < n; ++i)
+		for (size_t j=0; j < n; ++j)
+			s << "            newton_J[" << i << "][" << j << "] = " << m_p->print(block.jacobian[i*n+j]) << ";" << std::endl;
+	s << "            /* solve J*dx = r, Gauss with partial pivoting */" << std::endl;
+	s << "            for (newton_j = 0; newton_j < " << dim << "; ++newton_j)" << std::endl;
+	s << "            {" << std::endl;
+	s << "                newton_p = newton_j;" << std::endl;
+	s << "                for (newton_i = newton_j+1; newton_i < " << dim << "; ++newton_i)" << std::endl;
+	s << "                    if (fabs(newton_J[newton_i][newton_j]) > fabs(newton_J[newton_p][newton_j])) newton_p = newton_i;" << std::endl;
+	s << "                for (newton_l = 0; newton_l < " << dim << "; ++newton_l)" << std::endl;
+	s << "                {" << std::endl;
+	s << "                    newton_f = newton_J[newton_j][newton_l];" << std::endl;
+	s << "                    newton_J[newton_j][newton_l] = newton_J[newton_p][newton_l];" << std::endl;
+	s << "                    newton_J[newton_p][newton_l] = newton_f;" << std::endl;
+	s << "                }" << std::endl;
+	s << "                newton_f = newton_r[newton_j];" << std::endl;
+	s << "                newton_r[newton_j] = newton_r[newton_p];" << std::endl;
+	s << "                newton_r[newton_p] = newton_f;" << std::endl;
+	s << "                if (newton_J[newton_j][newton_j] == 0) break;" << std::endl;
+	s << "                for (newton_i = newton_j+1; newton_i < " << dim << "; ++newton_i)" << std::endl;
+	s << "                {" << std::endl;
+	s << "                    newton_f = newton_J[newton_i][newton_j]/newton_J[newton_j][newton_j];" << std::endl;
+	s << "                    for (newton_l = newton_j; newton_l < " << dim << "; ++newton_l)" << std::endl;
+	s << "                        newton_J[newton_i][newton_l] -= newton_f*newton_J[newton_j][newton_l];" << std::endl;
+	s << "                    newton_r[newton_i] -= newton_f*newton_r[newton_j];" << std::endl;
+	s << "                }" << std::endl;
+	s << "            }" << std::endl;
+	s << "            if (newton_j < " << dim << ")" << std::endl;
+	s << "            {" << std::endl;
+	s << "                newton_status = 2;" << std::endl;
+	s << "                break;" << std::endl;
+	s << "            }" << std::endl;
+	s << "            for (newton_j = " << n-1 << "; newton_j >= 0; --newton_j)" << std::endl;
+	s << "            {" << std::endl;
+	s << "                newton_dx[newton_j] = newton_r[newton_j];" << std::endl;
+	s << "                for (newton_l = newton_j+1; newton_l < " << dim << "; ++newton_l)" << std::endl;
+	s << "                    newton_dx[newton_j] -= newton_J[newton_j][newton_l]*newton_dx[newton_l];" << std::endl;
+	s << "                newton_dx[newton_j] /= newton_J[newton_j][newton_j];" << std::endl;
+	s << "            }" << std::endl;
+	s << "            newton_lambda = 1;" << std::endl;
+	s << "            newton_step = 0;" << std::endl;
+	s << "            for (newton_i = 0; newton_i < " << dim << "; ++newton_i)" << std::endl;
+	s << "            {" << std::endl;
+	s << "                newton_x[newton_i] -= newton_dx[newton_i];" << std::endl;
+	s << "                newton_step += fabs(newton_dx[newton_i]);" << std::endl;
+	s << "            }" << std::endl;
+	s << "        }" << std::endl;
+	s << "    }" << std::endl;
+
+	return s.str();
+}
+/*****************************************************************************/
+
 /*****************************************************************************/
 double CWriter::generatePymbsWrapper(Graph::Graph& g)
 /*****************************************************************************/
@@ -436,6 +570,8 @@ double CWriter::generatePymbsWrapper(Graph::Graph& g)
 
 	Graph::VariableVec state_inputs = g.getAssignments(DER_STATE)->getVariables(INPUT);
     Graph::VariableVec controller = g.getAssignments(DER_STATE)->getVariables(CONTROLLER);
+	// mit impliziten Bloecken liefert der_state newton_status zurueck
+	bool der_state_newton = hasNewtonBlock(g.getAssignments(DER_STATE)->getEquations(PARAMETER | CONSTANT | INPUT ));
     Graph::VariableVec sensors = g.getVariables(SENSOR);
 
 	// Sensors Vector sortieren: 
@@ -450,6 +586,8 @@ double CWriter::generatePymbsWrapper(Graph::Graph& g)
 	f << "# " << getHeaderLine() << std::endl;
 	f << std::endl;
 	f << "import platform" << std::endl;
+	if (der_state_newton)
+		f << "import warnings" << std::endl;
 	f << "from ctypes import c_double" << std::endl;
 	f << "from numpy import matrix, empty, zeros, ctypeslib" << std::endl;
 	f << std::endl;
@@ -520,12 +658,17 @@ double CWriter::generatePymbsWrapper(Graph::Graph& g)
         f << "    " << m_p->print(*it) << " = " << comment_vector.back() << "(t, y, sensors)" << std::endl;
 	}
 	f << "    yd = empty(y.shape)" << std::endl;
-	f << "    cm." << m_name << "_der_state(t, y, yd";
+	f << "    " << (der_state_newton ? "newton_status = " : "") << "cm." << m_name << "_der_state(t, y, yd";
     for (Graph::VariableVec::iterator it=state_inputs.begin();it!=state_inputs.end();++it)
         f << ", _inputs['" << p.print(*it) << "']";
     for (Graph::VariableVec::iterator it=controller.begin();it!=controller.end();++it)
         f << ", " << m_p->print(*it);
     f << ")" << std::endl;
+	if (der_state_newton)
+	{
+		f << "    if newton_status != 0:" << std::endl;
+		f << "        warnings.warn('der_state: implicit block failed, newton_status = %d' % newton_status)" << std::endl;
+	}
 	f << "    return yd" << std::endl;
 
 	f.close();
@@ -905,8 +1048,14 @@ double CWriter::generateAll(Graph::Graph& g, int &dim)
         f << "    double " << m_p->print(*it) << m_p->dimension(*it) << "= " << m_p->print(g.getinitVal(*it)) << "; " << m_p->comment2(g,*it) <<  std::endl;
 	f << std::endl;
 
+	std::vector<Graph::Assignment> equations = a->getEquations(PARAMETER | CONSTANT | INPUT );
+	bool newton = hasNewtonBlock(equations);
+	if (newton)
+		f << "    int newton_status = 0; /* 1: implicit block not converged, 2: singular Jacobian */" << std::endl << std::endl;
+
+	// im Fragment gibt es kein return, newton_status bleibt fuer den umgebenden Code stehen
 	f << "/* calculate sensors and state derivative */" << std::endl;
-	f << writeEquations(a->getEquations(PARAMETER | CONSTANT | INPUT )) << std::endl;
+	f << writeEquations(equations) << std::endl;
     f << std::endl;
 
 	f << "/* set return values */" << std::endl;
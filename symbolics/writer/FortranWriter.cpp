@@ -80,6 +80,9 @@ double FortranWriter::generateDerState(Graph::Graph& g)
     // Inputs Vector sortieren: 
 	std::sort(inputs.begin(),inputs.end(), sortVariableVec);
 
+	std::vector<Graph::Assignment> equations = a->getEquations(PARAMETER | CONSTANT | INPUT );
+	bool newton = hasNewtonBlock(equations);
+
 	std::ofstream f;
     std::string filename= m_path + "/" + m_name + "_der_state.f90";
     f.open(filename.c_str());
@@ -90,6 +93,8 @@ double FortranWriter::generateDerState(Graph::Graph& g)
 	f << "subroutine "<< m_name <<"_der_state(time, y, yd"; 
 	for (Graph::VariableVec::iterator it=inputs.begin();it!=inputs.end();++it)
 		f << ", " << m_p->print(*it); 
+	if (newton)
+		f << ", newton_status";
 	f << ")" << std::endl; 
 
 	f << "use functionmodule" << std::endl;
@@ -107,6 +112,8 @@ double FortranWriter::generateDerState(Graph::Graph& g)
     f << "    double precision, intent(in) :: time" << std::endl;
 	f << "    double precision, dimension(" << input_dim << ",1), intent(in) :: y" << std::endl;
 	f << "    double precision, dimension(" << input_dim << ",1), intent(out) :: yd" << std::endl;
+	if (newton)
+		f << "    integer, intent(out) :: newton_status ! 1: implicit block not converged, 2: singular Jacobian" << std::endl;
 	f << std::endl;
 
 	f << "!declare inputs" << std::endl;
@@ -156,8 +163,10 @@ double FortranWriter::generateDerState(Graph::Graph& g)
 	// fss << "write (*,*) \"y:=\", y" << std::endl; //for debug
 
 	fss << "!calculate state derivative" << std::endl;
+	if (newton)
+		fss << "    newton_status = 0" << std::endl;
 	std::vector<std::string> additionalVarDefs;
-	fss << writeEquations(a->getEquations(PARAMETER | CONSTANT | INPUT ), additionalVarDefs) << std::endl;
+	fss << writeEquations(g, equations, additionalVarDefs) << std::endl;
     fss << std::endl;
 
 	// Jetzt sind die tempor�ren Variablen bekannt
@@ -214,6 +223,9 @@ double FortranWriter::generateSensors(Graph::Graph& g)
 	// Sensors Vector sortieren: 
 	std::sort(sensors.begin(),sensors.end(), sortVariableVec);
 
+	std::vector<Graph::Assignment> equations = a->getEquations(PARAMETER | CONSTANT | INPUT );
+	bool newton = hasNewtonBlock(equations);
+
 	std::ofstream f;
     std::string filename= m_path + "/" + m_name + "_sensors.f90";
     f.open(filename.c_str());
@@ -229,6 +241,8 @@ double FortranWriter::generateSensors(Graph::Graph& g)
 			f << ", &" << std::endl <<"                " << m_p->print(*it);
 		else
 			f << ", " << m_p->print(*it); 
+	if (newton)
+		f << ", newton_status";
 	f << ")" << std::endl; 
 
 	f << "use functionmodule" << std::endl;
@@ -246,6 +260,8 @@ double FortranWriter::generateSensors(Graph::Graph& g)
 	f << "    double precision, dimension(" << input_dim << ",1), intent(in) :: y" << std::endl;
 	for (Graph::VariableVec::iterator it=sensors.begin();it!=sensors.end();++it)
 		f << "    double precision"<< m_p->dimension(*it) << ", intent(out) :: " << m_p->print(*it) << m_p->comment2(g,*it) << std::endl;
+	if (newton)
+		f << "    integer, intent(out) :: newton_status ! 1: implicit block not converged, 2: singular Jacobian" << std::endl;
 	f << std::endl;
 
 	f << "!declare inputs" << std::endl;
@@ -295,8 +311,10 @@ double FortranWriter::generateSensors(Graph::Graph& g)
 	// fss << "write (*,*) \"y:=\", y" << std::endl; //for debug
 
 	fss << "!calculate sensors" << std::endl;
+	if (newton)
+		fss << "    newton_status = 0" << std::endl;
 	std::vector<std::string> additionalVarDefs;
-	fss << writeEquations(a->getEquations(PARAMETER | CONSTANT | INPUT ), additionalVarDefs) << std::endl;
+	fss << writeEquations(g, equations, additionalVarDefs) << std::endl;
     fss << std::endl;
 
 	// Jetzt sind die tempor�ren Variablen bekannt
@@ -345,6 +363,9 @@ double FortranWriter::generateVisual(Graph::Graph& g)
 	// Visual_sensors Vector sortieren: 
 	std::sort(sens_vis.begin(),sens_vis.end(), sortVariableVec);
 
+	std::vector<Graph::Assignment> equations = a->getEquations(PARAMETER | CONSTANT | INPUT );
+	bool newton = hasNewtonBlock(equations);
+
 	std::ofstream f;
     std::string filename= m_path + "/" + m_name + "_visual.f90";
     f.open(filename.c_str());
@@ -355,6 +376,8 @@ double FortranWriter::generateVisual(Graph::Graph& g)
 	f << "subroutine "<< m_name <<"_visual(y"; 
 	for (Graph::VariableVec::iterator it=sens_vis.begin();it!=sens_vis.end();++it)
 		f << ", " << m_p->print(*it); 
+	if (newton)
+		f << ", newton_status";
 	f << ")" << std::endl; 
 
 	f << "use functionmodule" << std::endl;
@@ -371,6 +394,8 @@ double FortranWriter::generateVisual(Graph::Graph& g)
 	f << "    double precision, dimension(" << input_dim << ",1), intent(in) :: y" << std::endl;
 	for (Graph::VariableVec::iterator it=sens_vis.begin();it!=sens_vis.end();++it)
 		f << "    double precision"<< m_p->dimension(*it) << ", intent(out) :: " << m_p->print(*it) << m_p->comment2(g,*it) << std::endl;
+	if (newton)
+		f << "    integer, intent(out) :: newton_status ! 1: implicit block not converged, 2: singular Jacobian" << std::endl;
 	f << std::endl;
 
     
@@ -416,8 +441,10 @@ double FortranWriter::generateVisual(Graph::Graph& g)
 	// fss << "write (*,*) \"y:=\", y" << std::endl; //for debug
 
 	fss << "!calculate sensors" << std::endl;
+	if (newton)
+		fss << "    newton_status = 0" << std::endl;
 	std::vector<std::string> additionalVarDefs;
-	fss << writeEquations(a->getEquations(PARAMETER | CONSTANT | INPUT ), additionalVarDefs) << std::endl;
+	fss << writeEquations(g, equations, additionalVarDefs) << std::endl;
     fss << std::endl;
 
 	// Jetzt sind die tempor�ren Variablen bekannt
@@ -439,7 +466,7 @@ double FortranWriter::generateVisual(Graph::Graph& g)
 /*****************************************************************************/
 
 /*****************************************************************************/
-std::string FortranWriter::writeEquations(std::vector<Graph::Assignment> const& equations, std::vector<std::string> &additionalVarDefs) const
+std::string FortranWriter::writeEquations(Graph::Graph& g, std::vector<Graph::Assignment> const& equations, std::vector<std::string> &additionalVarDefs) const
 /*****************************************************************************/
 {
 	std::stringstream s;
@@ -447,41 +474,145 @@ std::string FortranWriter::writeEquations(std::vector<Graph::Assignment> const&
 	for (std::vector<Graph::Assignment>::const_iterator it=equations.begin(); it!=equations.end(); ++it)
     {
         if (it->implizit)
-            throw InternalError("Implicit equations are not yet implemented in Fortran!");
-		//Folgendes falls mehrere Gleichungen in einer verpackt sind (wird aber scheinbar kaum genutzt)
-		for (size_t i=0; i < it->lhs.size(); ++i)
         {
-            BasicPtr simple_exp = it->rhs[i]->simplify();
-            if (simple_exp.get() == NULL) throw InternalError("FortranWriter: Value of Rhs is not Valid!");
-            
-			//Workaround: links Matrix (also mehrere Ergebnisse)
-			if (it->lhs[i]->getType() == Type_Matrix)
-			{
-				const Matrix *mat = Util::getAsConstPtr<Matrix>(it->lhs[i]);
-				if (simple_exp->getType() == Type_Symbol)
-				{  // Wir k�nnen es ohne tempor�re Variable aufl�sen
-					for (size_t j=0; j < mat->getShape().getDimension(1); j++)
-						for (size_t k=0; k < mat->getShape().getDimension(2); k++)
-							s << "    " << m_p->print(mat->get(j,k)) << " = " << m_p->print(simple_exp) << "(" << j+1<< "," << k+1 << ")" << std::endl;
-				} else 	{  // Es muss eine tempor�re Variable eingef�hrt werden
-					additionalVarDefs.push_back("double precision" + m_p->dimension(it->lhs[i]) + " :: temp_var_" + str(additionalVarDefs.size() + 1));
-					s << "    temp_var_" << additionalVarDefs.size() << " = " << m_p->print(simple_exp) << std::endl; 
-					for (size_t j=0; j < mat->getShape().getDimension(1); j++)
-						for (size_t k=0; k < mat->getShape().getDimension(2); k++)
-							s << "    " << m_p->print(mat->get(j,k)) << " = temp_var_1(" << j+1<< "," << k+1 << ")" << std::endl;
-				}
-			} else {
-				// ordinary equation
-				s << "    " << m_p->print(it->lhs[i]) << " = " << m_p->print(simple_exp) << std::endl;
-				//s << "write (*,*) \"" << m_p->print(it->lhs[i]) << ": \", " << m_p->print(it->lhs[i]) << std::endl; //for Debug
-			}
+            s << writeNewtonBlock(g, *it, additionalVarDefs);
+            continue;
         }
+		//Folgendes falls mehrere Gleichungen in einer verpackt sind (wird aber scheinbar kaum genutzt)
+		for (size_t i=0; i < it->lhs.size(); ++i)
+            s << writeAssignment(it->lhs[i], it->rhs[i], additionalVarDefs, "    ");
     }
 
 	return s.str();
 }
 /*****************************************************************************/
 
+/*****************************************************************************/
+std::string FortranWriter::writeAssignment(BasicPtr const& lhs, BasicPtr const& rhs, std::vector<std::string> &additionalVarDefs, std::string const& indent) const
+/*****************************************************************************/
+{
+	std::stringstream s;
+
+    BasicPtr simple_exp = rhs->simplify();
+    if (simple_exp.get() == NULL) throw InternalError("FortranWriter: Value of Rhs is not Valid!");
+
+	//Workaround: links Matrix (also mehrere Ergebnisse)
+	if (lhs->getType() == Type_Matrix)
+	{
+		const Matrix *mat = Util::getAsConstPtr<Matrix>(lhs);
+		if (simple_exp->getType() == Type_Symbol)
+		{  // Wir k�nnen es ohne tempor�re Variable aufl�sen
+			for (size_t j=0; j < mat->getShape().getDimension(1); j++)
+				for (size_t k=0; k < mat->getShape().getDimension(2); k++)
+					s << indent << m_p->print(mat->get(j,k)) << " = " << m_p->print(simple_exp) << "(" << j+1<< "," << k+1 << ")" << std::endl;
+		} else 	{  // Es muss eine tempor�re Variable eingef�hrt werden
+			additionalVarDefs.push_back("double precision" + m_p->dimension(lhs) + " :: temp_var_" + str(additionalVarDefs.size() + 1));
+			s << indent << "temp_var_" << additionalVarDefs.size() << " = " << m_p->print(simple_exp) << std::endl;
+			for (size_t j=0; j < mat->getShape().getDimension(1); j++)
+				for (size_t k=0; k < mat->getShape().getDimension(2); k++)
+					s << indent << m_p->print(mat->get(j,k)) << " = temp_var_1(" << j+1<< "," << k+1 << ")" << std::endl;
+		}
+	} else {
+		// ordinary equation
+		s << indent << m_p->print(lhs) << " = " << m_p->print(simple_exp) << std::endl;
+		//s << "write (*,*) \"" << m_p->print(lhs) << ": \", " << m_p->print(lhs) << std::endl; //for Debug
+	}
+
+	return s.str();
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+std::string FortranWriter::writeNewtonBlock(Graph::Graph& g, Graph::Assignment const& a, std::vector<std::string> &additionalVarDefs) const
+/*****************************************************************************/
+{
+	// Gedaempftes Newton Verfahren fuer die Tearing Variablen, Startwert ist
+	// die Loesung des letzten Aufrufs (save, daher nicht reentrant).
+	// Fehler landen im Argument newton_status der Subroutine
+	NewtonBlock block = getNewtonBlock(a);
+	size_t n = block.unknowns.size();
+	std::string dim = str(n);
+	// Variablen des Blocks eindeutig benennen
+	std::string v = "newton" + str(additionalVarDefs.size() + 1) + "_";
+	additionalVarDefs.push_back("double precision, dimension(" + dim + "), save :: " + v + "x");
+	additionalVarDefs.push_back("logical, save :: " + v + "init = .false.");
+	additionalVarDefs.push_back("double precision, dimension(" + dim + ") :: " + v + "r, " + v + "dx, " + v + "row");
+	additionalVarDefs.push_back("double precision, dimension(" + dim + "," + dim + ") :: " + v + "jac");
+	additionalVarDefs.push_back("double precision :: " + v + "norm, " + v + "norm0, " + v + "lambda, " + v + "step, " + v + "f");
+	additionalVarDefs.push_back("integer :: " + v + "it, " + v + "i, " + v + "j, " + v + "p");
+	std::stringstream s;
+
+	s << "    ! implicit block: damped Newton iteration for";
+	for (size_t i=0; i < n; ++i)
+		s << " " << m_p->print(block.unknowns[i]);
+	s << std::endl;
+	s << "    ! warm start from the last call (save): not reentrant" << std::endl;
+	// erster Aufruf: Anfangswerte, die Variablen sind in Fortran nicht initialisiert
+	s << "    if (.not. " << v << "init) then" << std::endl;
+	for (size_t i=0; i < n; ++i)
+		s << "        " << v << "x(" << i+1 << ") = " << m_p->print(getStartValue(g, block.unknowns[i])) << std::endl;
+	s << "        " << v << "init = .true." << std::endl;
+	s << "    end if" << std::endl;
+	s << "    " << v << "norm0 = 0" << std::endl;
+	s << "    " << v << "lambda = 1" << std::endl;
+	s << "    " << v << "step = 1" << std::endl;
+	s << "    " << v << "it = 0" << std::endl;
+	s << "    do" << std::endl;
+	for (size_t i=0; i < n; ++i)
+		s << "        " << m_p->print(block.unknowns[i]) << " = " << v << "x(" << i+1 << ")" << std::endl;
+	for (size_t i=0; i < block.lhs.size(); ++i)
+		s << writeAssignment(block.lhs[i], block.rhs[i], additionalVarDefs, "        ");
+	for (size_t i=0; i < n; ++i)
+		s << "        " << v << "r(" << i+1 << ") = " << m_p->print(block.residuals[i]) << std::endl;
+	s << "        " << v << "norm = sum(abs(" << v << "r))" << std::endl;
+	s << "        if ((" << v << "it > 0) .and. (" << v << "norm > " << v << "norm0) .and. (" << v << "lambda > 1d-3)) then" << std::endl;
+	s << "            ! residual grew: halve the step" << std::endl;
+	s << "            " << v << "lambda = 0.5d0*" << v << "lambda" << std::endl;
+	s << "            " << v << "x = " << v << "x + " << v << "lambda*" << v << "dx" << std::endl;
+	s << "            " << v << "it = " << v << "it + 1" << std::endl;
+	s << "            cycle" << std::endl;
+	s << "        end if" << std::endl;
+	s << "        if ((" << v << "norm < 1d-10) .or. (" << v << "step < 1d-12) .or. (" << v << "it >= 50)) then" << std::endl;
+	s << "            if (" << v << "norm >= 1d-10) newton_status = 1" << std::endl;
+	s << "            exit" << std::endl;
+	s << "        end if" << std::endl;
+	s << "        " << v << "norm0 = " << v << "norm" << std::endl;
+	for (size_t i=0; i < n; ++i)
+		for (size_t j=0; j < n; ++j)
+			s << "        " << v << "jac(" << i+1 << "," << j+1 << ") = " << m_p->print(block.jacobian[i*n+j]) << std::endl;
+	s << "        ! solve J*dx = r, Gauss with partial pivoting" << std::endl;
+	s << "        do " << v << "j = 1, " << dim << std::endl;
+	s << "            " << v << "p = " << v << "j - 1 + maxloc(abs(" << v << "jac(" << v << "j:" << dim << "," << v << "j)), 1)" << std::endl;
+	s << "            " << v << "row = " << v << "jac(" << v << "j,:)" << std::endl;
+	s << "            " << v << "jac(" << v << "j,:) = " << v << "jac(" << v << "p,:)" << std::endl;
+	s << "            " << v << "jac(" << v << "p,:) = " << v << "row" << std::endl;
+	s << "            " << v << "f = " << v << "r(" << v << "j)" << std::endl;
+	s << "            " << v << "r(" << v << "j) = " << v << "r(" << v << "p)" << std::endl;
+	s << "            " << v << "r(" << v << "p) = " << v << "f" << std::endl;
+	s << "            if (" << v << "jac(" << v << "j," << v << "j) == 0) exit" << std::endl;
+	s << "            do " << v << "i = " << v << "j+1, " << dim << std::endl;
+	s << "                " << v << "f = " << v << "jac(" << v << "i," << v << "j)/" << v << "jac(" << v << "j," << v << "j)" << std::endl;
+	s << "                " << v << "jac(" << v << "i,:) = " << v << "jac(" << v << "i,:) - " << v << "f*" << v << "jac(" << v << "j,:)" << std::endl;
+	s << "                " << v << "r(" << v << "i) = " << v << "r(" << v << "i) - " << v << "f*" << v << "r(" << v << "j)" << std::endl;
+	s << "            end do" << std::endl;
+	s << "        end do" << std::endl;
+	s << "        if (" << v << "j <= " << dim << ") then" << std::endl;
+	s << "            newton_status = 2" << std::endl;
+	s << "            exit" << std::endl;
+	s << "        end if" << std::endl;
+	s << "        do " << v << "j = " << dim << ", 1, -1" << std::endl;
+	s << "            " << v << "dx(" << v << "j) = (" << v << "r(" << v << "j) - sum(" << v << "jac(" << v << "j," << v << "j+1:" << dim << ")*" << v << "dx(" << v << "j+1:" << dim << ")))/" << v << "jac(" << v << "j," << v << "j)" << std::endl;
+	s << "        end do" << std::endl;
+	s << "        " << v << "lambda = 1" << std::endl;
+	s << "        " << v << "step = sum(abs(" << v << "dx))" << std::endl;
+	s << "        " << v << "x = " << v << "x - " << v << "dx" << std::endl;
+	s << "        " << v << "it = " << v << "it + 1" << std::endl;
+	s << "    end do" << std::endl;
+
+	return s.str();
+}
+/*****************************************************************************/
+
 /*****************************************************************************/
 double FortranWriter::generatePymbsWrapper(Graph::Graph& g)
 /*****************************************************************************/
@@ -498,6 +629,8 @@ double FortranWriter::generatePymbsWrapper(Graph::Graph& g)
 	std::transform(m_name_lower.begin(), m_name_lower.end(), m_name_lower.begin(), ::tolower);
 	
 	Graph::VariableVec der_state_inputs = g.getAssignments(DER_STATE)->getVariables(INPUT);
+	// mit impliziten Bloecken liefert f2py zusaetzlich newton_status zurueck
+	bool der_state_newton = hasNewtonBlock(g.getAssignments(DER_STATE)->getEquations(PARAMETER | CONSTANT | INPUT ));
     // Inputs Vector sortieren: 
 	std::sort(der_state_inputs.begin(),der_state_inputs.end(), sortVariableVec);
 
@@ -507,6 +640,8 @@ double FortranWriter::generatePymbsWrapper(Graph::Graph& g)
 
 	f << "# " << getHeaderLine() << std::endl;
 	f << std::endl;
+	if (der_state_newton)
+		f << "import warnings" << std::endl;
 	f << "from scipy import matrix, zeros" << std::endl;
 	f << "from " << m_name << "_der_state_compiledF90 import " << m_name_lower << "_der_state" << std::endl;
 	f << std::endl;
@@ -524,10 +659,17 @@ double FortranWriter::generatePymbsWrapper(Graph::Graph& g)
 	f << "def ode_int(t, y):" << std::endl;
 	f << "    global _inputs" << std::endl;
 	f << std::endl;
-	f << "    return " << m_name_lower << "_der_state(t, y";
+	f << "    " << (der_state_newton ? "yd, newton_status = " : "return ") << m_name_lower << "_der_state(t, y";
     for (Graph::VariableVec::iterator it=der_state_inputs.begin();it!=der_state_inputs.end();++it)
         f << ", _inputs['" << p.print(*it) << "']";
     f << ")" << std::endl;
+	if (der_state_newton)
+	{
+		f << "    if newton_status != 0:" << std::endl;
+		f << "        warnings.warn('der_state: implicit block failed, newton_status = %d' % newton_status)" << std::endl;
+	}
+	if (der_state_newton)
+		f << "    return yd" << std::endl;
 
 	f.close();
 
@@ -537,6 +679,7 @@ double FortranWriter::generatePymbsWrapper(Graph::Graph& g)
 
 
 	Graph::VariableVec sens_vis = g.getAssignments(SENSOR_VISUAL)->getVariables(SENSOR_VISUAL);
+	bool visual_newton = hasNewtonBlock(g.getAssignments(SENSOR_VISUAL)->getEquations(PARAMETER | CONSTANT | INPUT ));
 	// Visual_sensors Vector sortieren:
 	std::sort(sens_vis.begin(),sens_vis.end(), sortVariableVec);
 
@@ -545,6 +688,8 @@ double FortranWriter::generatePymbsWrapper(Graph::Graph& g)
 
 	f << "# " << getHeaderLine() << std::endl;
 	f << std::endl;
+	if (visual_newton)
+		f << "import warnings" << std::endl;
 	f << "from scipy import matrix, zeros" << std::endl;
 	f << "from " << m_name << "_visual_compiledF90 import " << m_name_lower << "_visual" << std::endl;
 
@@ -552,7 +697,14 @@ double FortranWriter::generatePymbsWrapper(Graph::Graph& g)
 	f << "    ";
 	for (Graph::VariableVec::iterator it=sens_vis.begin();it!=sens_vis.end();++it)
 		f  << p.print(*it) << (it+1 != sens_vis.end() ? ", " : "" ); 
+	if (visual_newton)
+		f << ", newton_status";
 	f << " = " << m_name_lower << "_visual(q)" << std::endl;
+	if (visual_newton)
+	{
+		f << "    if newton_status != 0:" << std::endl;
+		f << "        warnings.warn('visual: implicit block failed, newton_status = %d' % newton_status)" << std::endl;
+	}
 	f << std::endl;
 
     f << "    res_dict = {}" << std::endl;
@@ -576,6 +728,7 @@ double FortranWriter::generatePymbsWrapper(Graph::Graph& g)
     }
 
     Graph::VariableVec sensor_inputs = g.getAssignments(SENSOR)->getVariables(INPUT);
+	bool sensors_newton = hasNewtonBlock(g.getAssignments(SENSOR)->getEquations(PARAMETER | CONSTANT | INPUT ));
     // Inputs Vector sortieren: 
 	std::sort(sensor_inputs.begin(),sensor_inputs.end(), sortVariableVec);
 
@@ -587,6 +740,8 @@ double FortranWriter::generatePymbsWrapper(Graph::Graph& g)
 
 	f << "# " << getHeaderLine() << std::endl;
 	f << std::endl;
+	if (sensors_newton)
+		f << "import warnings" << std::endl;
 	f << "from scipy import matrix, zeros" << std::endl;
 	f << "from " << m_name << "_sensors_compiledF90 import " << m_name_lower << "_sensors" << std::endl;
     f << std::endl;
@@ -607,10 +762,17 @@ double FortranWriter::generatePymbsWrapper(Graph::Graph& g)
     f << "    ";
 	for (Graph::VariableVec::iterator it=sensor.begin();it!=sensor.end();++it)
 		f  << p.print(*it) << (it+1 != sensor.end() ? ", " : "" ); 
+	if (sensors_newton)
+		f << ", newton_status";
 	f << " = " << m_name_lower << "_sensors(t, q";
     for (Graph::VariableVec::iterator it=sensor_inputs.begin();it!=sensor_inputs.end();++it)
         f << ", _inputs['" << p.print(*it) << "']";
     f << ")" << std::endl;
+	if (sensors_newton)
+	{
+		f << "    if newton_status != 0:" << std::endl;
+		f << "        warnings.warn('sensors: implicit block failed, newton_status = %d' % newton_status)" << std::endl;
+	}
     f << "    res_dict = {}" << std::endl;
 	for (Graph::VariableVec::iterator it=sensor.begin();it!=sensor.end();++it)
 		f  << "    res_dict.update({'" << p.print(*it) << "' : " << p.print(*it) << "})" << std::endl; 
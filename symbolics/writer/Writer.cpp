@@ -73,3 +73,154 @@ bool Writer::sortVariableVec (boost::intrusive_ptr<Symbolics::Symbol> a, boost::
 	return (*(a.get()) < *(b.get())); 
 }
 /*****************************************************************************/
+
+/*****************************************************************************/
+// skalares Element i (zeilenweise) eines Ausdrucks
+static BasicPtr scalarEntry(BasicPtr const& exp, size_t i)
+/*****************************************************************************/
+{
+    if (exp->is_Scalar())
+        return exp;
+    size_t dim2 = exp->getShape().getDimension(2);
+    return Element::New(exp,i / dim2,i % dim2)->simplify();
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+// Ersetzung old -> value eintragen, fuer Elemente auch im ganzen Symbol
+static void addReplacement(BasicPtrMap &repl, std::map<BasicPtr,BasicPtrVec> &partial,
+                           BasicPtr const& old, BasicPtr const& value)
+/*****************************************************************************/
+{
+    if (old->getType() == Type_Matrix)
+    {
+        for (size_t i=0;i<old->getShape().getNumEl();++i)
+            addReplacement(repl,partial,old->getArg(i),scalarEntry(value,i));
+        return;
+    }
+    repl[old] = value;
+    if (old->getType() != Type_Element)
+        return;
+    const Element *e = Util::getAsConstPtr<Element>(old);
+    BasicPtr const& arg = e->getArg(0);
+    Shape const& shape = arg->getShape();
+    std::map<BasicPtr,BasicPtrVec>::iterator ip = partial.find(arg);
+    if (ip == partial.end())
+    {
+        BasicPtrVec values;
+        values.reserve(shape.getNumEl());
+        for (size_t r=0;r<shape.getDimension(1);++r)
+            for (size_t c=0;c<shape.getDimension(2);++c)
+                values.push_back(Element::New(arg,r,c));
+        ip = partial.insert(std::make_pair(arg,values)).first;
+    }
+    ip->second[e->getRow()*shape.getDimension(2) + e->getCol()] = value;
+    repl[arg] = BasicPtr(new Matrix(ip->second,shape));
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+// Tearing nach der Ableitung eines Zustands ($DERx): im Residuum und im
+// erzeugten Code steht dafuer der(x), das Symbol selbst wird nie deklariert
+static BasicPtr stateDerivative(BasicPtr const& var)
+/*****************************************************************************/
+{
+    if ((var->getType() != Type_Symbol) || !var->is_Scalar())
+        return var;
+    const Symbol *s = Util::getAsConstPtr<Symbol>(var);
+    Symbol *state = static_cast<Symbol*>(s->getUserData(ID_UD_STATE));
+    if ((state == NULL) || !(state->is_State(0,0) & STATE))
+        return var;
+    return Der::New(BasicPtr(state));
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+Writer::NewtonBlock Writer::getNewtonBlock(Graph::Assignment const& a)
+/*****************************************************************************/
+{
+    NewtonBlock block;
+    if (a.residuals > a.lhs.size())
+        throw InternalError("Implicit block with more residuals than equations");
+    size_t numExplicit = a.lhs.size() - a.residuals;
+
+    // Unbekannte als neue Symbole, damit nach ihnen abgeleitet werden kann
+    BasicPtrMap repl;
+    std::map<BasicPtr,BasicPtrVec> partial;
+    BasicPtrVec unknownSymbols;
+    for (size_t i=0;i<a.tearing.size();++i)
+    {
+        BasicPtr tearing = stateDerivative(a.tearing[i]);
+        for (size_t j=0;j<tearing->getShape().getNumEl();++j)
+        {
+            BasicPtr u = scalarEntry(tearing,j);
+            BasicPtr s(new Symbol("__newton_" + str(block.unknowns.size())));
+            block.unknowns.push_back(u);
+            unknownSymbols.push_back(s);
+            addReplacement(repl,partial,u,s);
+        }
+    }
+    // Zuweisungen der Reihe nach einsetzen
+    for (size_t i=0;i<numExplicit;++i)
+    {
+        block.lhs.push_back(a.lhs[i]);
+        block.rhs.push_back(a.rhs[i]);
+        addReplacement(repl,partial,a.lhs[i],a.rhs[i]->subs(repl)->simplify());
+    }
+    BasicPtrVec residuals;
+    for (size_t i=numExplicit;i<a.lhs.size();++i)
+    {
+        BasicPtr res = (a.lhs[i] - a.rhs[i])->simplify();
+        BasicPtr sres = res->subs(repl)->simplify();
+        for (size_t j=0;j<res->getShape().getNumEl();++j)
+        {
+            block.residuals.push_back(scalarEntry(res,j));
+            residuals.push_back(scalarEntry(sres,j));
+        }
+    }
+    size_t n = block.unknowns.size();
+    if ((n == 0) || (residuals.size() != n))
+        throw InternalError("Implicit block with " + str(residuals.size()) + " residuals for " + str(n) + " unknowns");
+
+    // Jacobimatrix, danach wieder in den Unbekannten ausdruecken
+    BasicPtr jac = Jacobian::New(BasicPtr(new Matrix(residuals,Shape(n))),BasicPtr(new Matrix(unknownSymbols,Shape(n))));
+    BasicPtrMap back;
+    for (size_t i=0;i<n;++i)
+        back[unknownSymbols[i]] = block.unknowns[i];
+    block.jacobian.reserve(n*n);
+    for (size_t i=0;i<n;++i)
+        for (size_t j=0;j<n;++j)
+            block.jacobian.push_back(Element::New(jac,i,j)->simplify()->subs(back)->simplify());
+    return block;
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+BasicPtr Writer::getStartValue(Graph::Graph& g, BasicPtr const& unknown)
+/*****************************************************************************/
+{
+    // Ableitung eines Zustands, wie der_x im erzeugten Code mit 0 beginnen
+    if (unknown->getType() == Type_Der)
+        return Int::New(0);
+    if (unknown->getType() == Type_Symbol)
+        return g.getinitVal(SymbolPtr(const_cast<Symbol*>(Util::getAsConstPtr<Symbol>(unknown))));
+    if (unknown->getType() != Type_Element)
+        throw InternalError("Writer: no start value for " + unknown->toString());
+    const Element *e = Util::getAsConstPtr<Element>(unknown);
+    BasicPtr init = getStartValue(g,e->getArg(0));
+    if (init->is_Scalar())
+        return init;
+    return Element::New(init,e->getRow(),e->getCol())->simplify();
+}
+/*****************************************************************************/
+
+/*****************************************************************************/
+bool Writer::hasNewtonBlock(std::vector<Graph::Assignment> const& equations)
+/*****************************************************************************/
+{
+    for (std::vector<Graph::Assignment>::const_iterator it=equations.begin(); it!=equations.end(); ++it)
+        if (it->implizit)
+            return true;
+    return false;
+}
+/*****************************************************************************/
@@ -21,6 +21,9 @@ namespace Symbolics
 		CPrinter *m_p; // Der Hauptprinter dieser Writerklasse
 
 		std::string writeEquations(std::vector<Graph::Assignment> const& equations) const;
+		std::string writeAssignment(BasicPtr const& lhs, BasicPtr const& rhs, std::string const& indent) const;
+		// implizite Bloecke mit Newton Iteration
+		std::string writeNewtonBlock(Graph::Assignment const& a) const;
 		double generateFunctionmodule(int n);
 
     private:
@@ -18,7 +18,10 @@ namespace Symbolics
     protected:
         double generateTarget_Impl(Graph::Graph& g);
         
-        std::string writeEquations(std::vector<Graph::Assignment> const& equations, std::vector<std::string> &additionalVarDefs) const;
+        std::string writeEquations(Graph::Graph& g, std::vector<Graph::Assignment> const& equations, std::vector<std::string> &additionalVarDefs) const;
+        std::string writeAssignment(BasicPtr const& lhs, BasicPtr const& rhs, std::vector<std::string> &additionalVarDefs, std::string const& indent) const;
+        // implizite Bloecke mit Newton Iteration
+        std::string writeNewtonBlock(Graph::Graph& g, Graph::Assignment const& a, std::vector<std::string> &additionalVarDefs) const;
         double generateFunctionmodule();
 
         FortranPrinter *m_p; // Der Hauptprinter dieser Writerklasse
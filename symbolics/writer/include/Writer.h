@@ -38,6 +38,27 @@ namespace Symbolics
 		// Die Funktion muss static sein, da sie als functionpointer verwendet wird
 		static bool sortVariableVec (boost::intrusive_ptr<Symbolics::Symbol> a, boost::intrusive_ptr<Symbolics::Symbol> b);
 
+        // Implizite Bloecke (Tearing) fuer eine Newton Iteration: skalare
+        // Unbekannte, explizite Zuweisungen, skalare Residuen (lhs - rhs) und
+        // die Jacobimatrix der Residuen nach den Unbekannten (zeilenweise),
+        // in der die Zuweisungen bereits eingesetzt sind
+        struct NewtonBlock
+        {
+            BasicPtrVec unknowns;
+            BasicPtrVec lhs;
+            BasicPtrVec rhs;
+            BasicPtrVec residuals;
+            BasicPtrVec jacobian;
+        };
+        static NewtonBlock getNewtonBlock(Graph::Assignment const& a);
+        // Anfangswert einer skalaren Unbekannten (Symbol oder Element)
+        static BasicPtr getStartValue(Graph::Graph& g, BasicPtr const& unknown);
+        // Gibt es implizite Bloecke? Dann bekommt die erzeugte Funktion einen
+        // Status newton_status (0: ok, 1: nicht konvergiert, 2: Jacobimatrix
+        // singulaer). Die Startwerte der Iteration sind static/save, die
+        // erzeugten Funktionen sind damit nicht reentrant
+        static bool hasNewtonBlock(std::vector<Graph::Assignment> const& equations);
+
     public:
         double generateTarget(std::string name, std::string path, Graph::Graph& g, bool optimize);
 
@@ -89,6 +89,43 @@ namespace Symbolics
             return gr;
         };
 
+        // wie getGraphDAE, aber mit x als Zustand (die Auswahl der Dummy-Zustaende
+        // haengt von den Namen ab), ohne y und yd, die im C Code Argumente sind
+        Graph::Graph getGraphDAE_x()
+        {
+            Graph::Graph gr;
+
+            SymbolPtr L(new Symbol("L",PARAMETER));
+            SymbolPtr m(new Symbol("m",PARAMETER));
+            SymbolPtr g(new Symbol("g",PARAMETER));
+            SymbolPtr x(new Symbol("x"));
+            SymbolPtr h(new Symbol("h"));
+            SymbolPtr u(new Symbol("u"));
+            SymbolPtr w(new Symbol("w"));
+            SymbolPtr F(new Symbol("F"));
+
+            gr.addSymbol(L);
+            gr.addSymbol(m); 
+            gr.addSymbol(g);
+            gr.addSymbol(x,L.get());
+            gr.addSymbol(h,L.get());
+            gr.addSymbol(u);
+            gr.addSymbol(w);
+            gr.addSymbol(F);
+
+            gr.addExpression(L,Int::New(1));
+            gr.addExpression(m,Int::New(1));
+            gr.addExpression(g,Real::New(9.81));
+
+            gr.addExpression(NULL,Pow::New(x,Int::New(2)) +  Pow::New(h,Int::New(2)) - Pow::New(L,Int::New(2))); 
+            gr.addExpression(NULL,Der::New(x)-u);  
+            gr.addExpression(NULL,Der::New(h)-w);  
+            gr.addExpression(NULL,m*Der::New(u)+Util::div(x*F,L)); 
+            gr.addExpression(NULL,m*Der::New(w)+m*g+Util::div(F*h,L)); 
+
+            return gr;
+        };
+
         Graph::Graph getGraph_expl()
         {
             Graph::Graph gr;
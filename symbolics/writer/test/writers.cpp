@@ -1,5 +1,8 @@
 #include <iostream>
 #include <cstdlib>
+#include <cmath>
+#include <fstream>
+#include <sstream>
 #include "Symbolics.h"
 #include "pendulum.h"
 #include "ModelicaWriter.h"
@@ -40,6 +43,179 @@ int pendulumDAE( )
               //Keine Aussage dar�ber ob sich der Code mit einem Modelica Compiler �bersetzen l�sst.
 }
 
+int pendulumDAE_c( )
+{
+    // implizite Bloecke werden mit einer Newton Iteration geschrieben
+    try
+    {
+        Graph::Graph g = Pendulum::getGraphDAE();
+        g.buildGraph(true);
+        CWriter cwriter;
+        cwriter.generateTarget("PendulumDAE","./.",g,true);
+        Graph::Graph g2 = Pendulum::getGraphDAE();
+        g2.buildGraph(true);
+        FortranWriter fwriter;
+        fwriter.generateTarget("PendulumDAE","./.",g2,true);
+    }
+    catch (...)
+    {
+        return -1;
+    }
+    return 0;
+}
+
+// Zugriff auf den Newton Block des Writers
+class NewtonBlockWriter: public CWriter
+{
+public:
+    // Ausdruck mit Zahlen fuer die Symbole auswerten
+    static double eval(BasicPtr const& exp, std::map<std::string,double> const& values)
+    {
+        BasicPtrMap repl;
+        Basic::BasicSet atoms = exp->getAtoms();
+        for (Basic::BasicSet::iterator it=atoms.begin(); it!=atoms.end(); ++it)
+        {
+            if ((*it)->getType() != Type_Symbol) continue;
+            std::map<std::string,double>::const_iterator v = values.find(Util::getAsConstPtr<Symbol>(*it)->getName());
+            if (v != values.end())
+                repl[*it] = Real::New(v->second);
+        }
+        BasicPtr res = exp->subs(repl)->simplify();
+        if (res->getType() == Type_Real) return Util::getAsConstPtr<Real>(res)->getValue();
+        if (res->getType() == Type_Int) return Util::getAsConstPtr<Int>(res)->getValue();
+        throw InternalError("Not a number: " + res->toString());
+    }
+
+    // Block fuer x aus x^2 + y^2 = L^2: Residuum und Jacobimatrix 2*x pruefen
+    static int checkPendulumDAE(std::vector<Graph::Assignment> const& equations)
+    {
+        int found = 0;
+        for (std::vector<Graph::Assignment>::const_iterator it=equations.begin(); it!=equations.end(); ++it)
+        {
+            if (!it->implizit) continue;
+            NewtonBlock block = getNewtonBlock(*it);
+            size_t n = block.unknowns.size();
+            if ((n == 0) || (block.residuals.size() != n) || (block.jacobian.size() != n*n)) return -1;
+            if (block.unknowns[0]->toString() == "F") found |= 2;
+            if (block.unknowns[0]->toString() != "x") continue;
+            std::map<std::string,double> values;
+            values["L"] = 1;
+            values["y"] = 0.8;
+            values["x"] = 0.6;
+            if (fabs(eval(block.residuals[0],values)) > 1e-12) return -2;
+            if (fabs(fabs(eval(block.jacobian[0],values)) - 1.2) > 1e-12) return -3;
+            values["x"] = 0.5;
+            if (fabs(fabs(eval(block.residuals[0],values)) - 0.11) > 1e-12) return -4;
+            found |= 1;
+        }
+        // x und F (Tearing), der(y) ist je nach Zuordnung auch explizit
+        if (found != 3) return -5;
+        return 0;
+    }
+};
+
+// Inhalt einer erzeugten Datei
+std::string readFile(std::string const& name)
+{
+    std::ifstream f(name.c_str());
+    std::stringstream s;
+    s << f.rdbuf();
+    return s.str();
+}
+
+int pendulumDAE_newton( )
+{
+    try
+    {
+        // wie in Writer::generateTarget
+        Graph::Graph g = Pendulum::getGraphDAE();
+        g.buildGraph(true);
+        g.makeScalar();
+        g.buildGraph(true);
+        int res = NewtonBlockWriter::checkPendulumDAE(g.getAssignments(DER_STATE)->getEquations(PARAMETER | CONSTANT | INPUT));
+        if (res != 0) return res;
+    }
+    catch (...)
+    {
+        return -6;
+    }
+
+    // Status der Iteration wird zurueckgegeben (von pendulumDAE_c erzeugt)
+    std::string c = readFile("PendulumDAE_der_state.c");
+    if (c.find("int newton_status = 0;") == std::string::npos) return -7;
+    if (c.find("newton_status = 2;") == std::string::npos) return -8;
+    if (c.find("return newton_status;") == std::string::npos) return -9;
+    std::string f90 = readFile("PendulumDAE_der_state.f90");
+    if (f90.find("integer, intent(out) :: newton_status") == std::string::npos) return -10;
+    if (f90.find("newton_status = 1") == std::string::npos) return -11;
+    return 0;
+}
+
+// Datei schreiben
+void writeFile(std::string const& name, std::string const& text)
+{
+    std::ofstream f(name.c_str());
+    f << text;
+}
+
+int pendulumDAE_run( )
+{
+    // x ist Zustand, der Newton Block loest nach der(x) auf
+    try
+    {
+        Graph::Graph g = Pendulum::getGraphDAE_x();
+        g.buildGraph(true);
+        CWriter cwriter;
+        cwriter.generateTarget("PendulumDAE_x","./.",g,true);
+        Graph::Graph g2 = Pendulum::getGraphDAE_x();
+        g2.buildGraph(true);
+        FortranWriter fwriter;
+        fwriter.generateTarget("PendulumDAE_x","./.",g2,true);
+    }
+    catch (...)
+    {
+        return -1;
+    }
+    std::string c = readFile("PendulumDAE_x_der_state.c");
+    if (c.find("iteration for der_x") == std::string::npos) return -2;
+    if ((c.find("double w = y[0];") == std::string::npos) || (c.find("double x = y[1];") == std::string::npos)) return -3;
+
+    // einen Schritt rechnen: x=0.6, der(h)=0.5, also h=0.8 und
+    // 2*x*der(x) + 2*h*der(h) = 0, der(w) = -g - F*h mit F = v^2 - g*h
+    writeFile("PendulumDAE_x_run.c",
+        "#include <math.h>\n"
+        "int PendulumDAE_x_der_state(double time, double * y, double * yd);\n"
+        "int main()\n"
+        "{\n"
+        "    double y[2] = {0.5, 0.6}, yd[2] = {0, 0};\n"
+        "    double F;\n"
+        "    if (PendulumDAE_x_der_state(0, y, yd) != 0) return 1;\n"
+        "    if (fabs(2*0.8*y[0] + 2*y[1]*yd[1]) > 1e-10) return 2;\n"
+        "    F = y[0]*y[0] + yd[1]*yd[1] - 9.81*0.8;\n"
+        "    if (fabs(yd[0] + 9.81 + F*0.8) > 1e-10) return 3;\n"
+        "    return 0;\n"
+        "}\n");
+    std::string cmd = "gcc -D\"__declspec(x)=\" PendulumDAE_x_der_state.c PendulumDAE_x_run.c -lm -o PendulumDAE_x_run && ./PendulumDAE_x_run";
+    if (system(cmd.c_str()) != 0) return -4;
+
+    writeFile("PendulumDAE_x_run.f90",
+        "program run\n"
+        "    double precision, dimension(2,1) :: y, yd\n"
+        "    double precision :: F\n"
+        "    integer :: newton_status\n"
+        "    y(1,1) = 0.5d0\n"
+        "    y(2,1) = 0.6d0\n"
+        "    call PendulumDAE_x_der_state(0d0, y, yd, newton_status)\n"
+        "    if (newton_status /= 0) stop 1\n"
+        "    if (abs(2d0*0.8d0*y(1,1) + 2d0*y(2,1)*yd(2,1)) > 1d-10) stop 2\n"
+        "    F = y(1,1)**2 + yd(2,1)**2 - 9.81d0*0.8d0\n"
+        "    if (abs(yd(1,1) + 9.81d0 + F*0.8d0) > 1d-10) stop 3\n"
+        "end program\n");
+    cmd = "gfortran -ffree-line-length-none -fdollar-ok functionmodule.f90 PendulumDAE_x_der_state.f90 PendulumDAE_x_run.f90 -o PendulumDAE_x_runf && ./PendulumDAE_x_runf";
+    if (system(cmd.c_str()) != 0) return -5;
+    return 0;
+}
+
 int pend_expl_mod( )
 {
     
@@ -129,6 +305,12 @@ int main( int argc,  char *argv[])
     if (res != 0) return -1;
     res = pendulumDAE();
     if (res != 0) return -2;
+    res = pendulumDAE_c();
+    if (res != 0) return -8;
+    res = pendulumDAE_newton();
+    if (res != 0) return -9;
+    res = pendulumDAE_run();
+    if (res != 0) return -10;
     res = pend_expl_mod();
     if (res != 0) return -3;
     res = pend_expl_mat();